@@ -0,0 +1,239 @@
+#include<bits/stdc++.h>
+#include "DSU.h"
+using namespace std;
+
+/**
+ * The DSU each module used to carry, kept here as the benchmark baseline:
+ * unordered_map parents and recursive find (VersionCompatibility.cpp)
+ */
+class MapDSU {
+private:
+    unordered_map<int, int> parent;
+    unordered_map<int, int> size;
+
+public:
+    int find(int x) {
+        if (parent.find(x) == parent.end()) {
+            parent[x] = x;
+            size[x] = 1;
+            return x;
+        }
+        if (parent[x] != x) {
+            parent[x] = find(parent[x]);
+        }
+        return parent[x];
+    }
+
+    void unionBySize(int x, int y) {
+        int rootX = find(x);
+        int rootY = find(y);
+        if (rootX != rootY) {
+            if (size[rootX] < size[rootY]) swap(rootX, rootY);
+            parent[rootY] = rootX;
+            size[rootX] += size[rootY];
+        }
+    }
+};
+
+/**
+ * map<Point, Point> parents with union by rank (NumberOfIslandsInATerrain.cpp)
+ */
+class PointMapDSU {
+private:
+    map<pair<int, int>, pair<int, int>> parent;
+    map<pair<int, int>, int> rank;
+
+public:
+    pair<int, int> find(pair<int, int> p) {
+        if (!parent.count(p)) {
+            parent[p] = p;
+            rank[p] = 0;
+        }
+        if (parent[p] == p) return p;
+        return parent[p] = find(parent[p]);
+    }
+
+    void unionSets(pair<int, int> a, pair<int, int> b) {
+        pair<int, int> rootA = find(a), rootB = find(b);
+        if (rootA == rootB) return;
+        if (rank[rootA] < rank[rootB]) swap(rootA, rootB);
+        parent[rootB] = rootA;
+        if (rank[rootA] == rank[rootB]) rank[rootA]++;
+    }
+};
+
+double elapsedMs(chrono::steady_clock::time_point start) {
+    return chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+}
+
+/**
+ * n elements, n random unions, then n random connectivity checks
+ */
+void benchmarkDense(int n) {
+    mt19937 rng(1);
+    vector<pair<int, int>> edges(n), queries(n);
+    for (auto& [a, b] : edges) a = rng() % n, b = rng() % n;
+    for (auto& [a, b] : queries) a = rng() % n, b = rng() % n;
+
+    auto start = chrono::steady_clock::now();
+    DenseDSU<> dense(n);
+    for (auto& [a, b] : edges) dense.unionBySize(a, b);
+    long long denseHits = 0;
+    for (auto& [a, b] : queries) denseHits += dense.connected(a, b);
+    double denseMs = elapsedMs(start);
+
+    start = chrono::steady_clock::now();
+    MapDSU mapDSU;
+    for (auto& [a, b] : edges) mapDSU.unionBySize(a, b);
+    long long mapHits = 0;
+    for (auto& [a, b] : queries) mapHits += mapDSU.find(a) == mapDSU.find(b);
+    double mapMs = elapsedMs(start);
+
+    cout << "Dense backend, " << n << " elements / unions / queries:\n";
+    cout << "  DenseDSU:                  " << denseMs << " ms (connected: " << denseHits << ", components: " << dense.componentCount() << ")\n";
+    cout << "  unordered_map + recursion: " << mapMs << " ms (connected: " << mapHits << ")\n";
+}
+
+/**
+ * Terrain-style workload: `lands` random cells of a side x side grid, each unioned
+ * with its land neighbours, then one find per cell
+ */
+void benchmarkHashed(int side, int lands) {
+    mt19937 rng(2);
+    vector<pair<int, int>> cells(lands);
+    for (auto& [x, y] : cells) x = rng() % side, y = rng() % side;
+    const int dx[4] = {0, 0, 1, -1}, dy[4] = {1, -1, 0, 0};
+
+    auto start = chrono::steady_clock::now();
+    HashedDSU<pair<int, int>, DSUPairHash> hashed;
+    hashed.reserve(lands);
+    for (auto& cell : cells) {
+        if (!hashed.add(cell)) continue;
+        for (int d = 0; d < 4; d++) {
+            pair<int, int> neighbour = {cell.first + dx[d], cell.second + dy[d]};
+            if (hashed.contains(neighbour)) hashed.unionBySize(cell, neighbour);
+        }
+    }
+    long long hashedChecksum = 0;
+    for (auto& cell : cells) hashedChecksum += hashed.componentSize(cell);
+    double hashedMs = elapsedMs(start);
+
+    start = chrono::steady_clock::now();
+    PointMapDSU pointMap;
+    set<pair<int, int>> seen;
+    for (auto& cell : cells) {
+        if (!seen.insert(cell).second) continue;
+        pointMap.find(cell);
+        for (int d = 0; d < 4; d++) {
+            pair<int, int> neighbour = {cell.first + dx[d], cell.second + dy[d]};
+            if (seen.count(neighbour)) pointMap.unionSets(cell, neighbour);
+        }
+    }
+    long long rootChecksum = 0;
+    for (auto& cell : cells) rootChecksum += pointMap.find(cell) == cell;
+    double mapMs = elapsedMs(start);
+
+    cout << "Hashed backend, " << lands << " land cells on a " << side << "x" << side << " grid:\n";
+    cout << "  HashedDSU<Point>:        " << hashedMs << " ms (islands: " << hashed.componentCount() << ")\n";
+    cout << "  map<Point, Point> + set: " << mapMs << " ms\n";
+}
+
+/**
+ * n elements, n random unions split across `threads` threads. The component count is
+ * checked against a sequential DenseDSU over the same edges.
+ */
+void benchmarkConcurrent(int n, int threads) {
+    mt19937 rng(3);
+    vector<pair<uint32_t, uint32_t>> edges(n);
+    for (auto& [a, b] : edges) a = rng() % n, b = rng() % n;
+
+    DenseDSU<uint32_t> reference(n);
+    for (auto& [a, b] : edges) reference.unionBySize(a, b);
+
+    for (int t : {1, threads}) {
+        ConcurrentDSU dsu(n);
+        atomic<long long> merges{0};
+        auto start = chrono::steady_clock::now();
+        vector<thread> workers;
+        for (int w = 0; w < t; w++) {
+            workers.emplace_back([&, w]() {
+                long long local = 0;
+                for (size_t i = w; i < edges.size(); i += t) local += dsu.unionSets(edges[i].first, edges[i].second);
+                merges += local;
+            });
+        }
+        for (thread& worker : workers) worker.join();
+        double ms = elapsedMs(start);
+
+        bool same = n - merges == reference.componentCount();
+        for (int i = 0; i < n && same; i += 997) {
+            int j = edges[i].second;
+            same = dsu.connected(edges[i].first, j) && dsu.connected(i, j) == reference.connected(i, j);
+        }
+        cout << "  ConcurrentDSU, " << t << " thread(s): " << ms << " ms (components: " << n - merges
+             << ", matches DenseDSU: " << (same ? "yes" : "no") << ")\n";
+    }
+}
+
+int main() {
+    cout << "Testing DenseDSU:\n";
+    DenseDSU<> dense(6);
+    assert(dense.unionBySize(0, 1) == true);
+    assert(dense.unionBySize(1, 2) == true);
+    assert(dense.unionBySize(0, 2) == false);
+    assert(dense.connected(0, 2) == true);
+    assert(dense.connected(0, 3) == false);
+    assert(dense.componentSize(2) == 3);
+    assert(dense.componentCount() == 4);
+    cout << "DenseDSU tests passed!\n\n";
+
+    cout << "Testing HashedDSU:\n";
+    HashedDSU<string> names;
+    names.unionBySize("alice", "bob");
+    names.unionBySize("carol", "dave");
+    assert(names.connected("alice", "bob") == true);
+    assert(names.connected("bob", "carol") == false);
+    names.unionBySize("bob", "dave");
+    assert(names.connected("alice", "carol") == true);
+    assert(names.componentSize("dave") == 4);
+    assert(names.contains("erin") == false);
+    assert(names.add("erin") == true);
+    assert(names.add("erin") == false);
+    assert(names.componentCount() == 2);
+    cout << "HashedDSU tests passed!\n\n";
+
+    cout << "Testing ConcurrentDSU:\n";
+    ConcurrentDSU concurrent(6);
+    assert(concurrent.unionSets(0, 1) == true);
+    assert(concurrent.unionSets(1, 2) == true);
+    assert(concurrent.unionSets(2, 0) == false);
+    assert(concurrent.connected(0, 2) == true);
+    assert(concurrent.connected(3, 4) == false);
+    cout << "ConcurrentDSU tests passed!\n\n";
+
+    benchmarkDense(2000000);
+    benchmarkHashed(2000, 1000000);
+    cout << "Concurrent backend, 5000000 elements / unions:\n";
+    benchmarkConcurrent(5000000, max(2u, thread::hardware_concurrency()));
+    return 0;
+}
+
+/*
+Problem Summary:
+Several modules carried their own union-find:
+- VersionCompatibility.cpp: unordered_map<int, int> parents, recursive find
+- NumberOfIslandsInATerrain.cpp: map<Point, Point> parents, recursive find
+DSU.h is one header-only library for all of them.
+
+Backends:
+- DenseDSU<Index>: flat parent/size vectors over 0..n-1, iterative path halving
+  (parent[x] = parent[parent[x]] while walking up), union by size.
+- HashedDSU<Key, Hash>: interns each key to a dense id once, then runs DenseDSU.
+  The hash lookup happens once per call instead of once per step of the find path.
+- ConcurrentDSU: atomic parent array. Roots are linked by a fixed random priority
+  with a single CAS, and find does CAS path halving, so no thread ever blocks.
+
+Complexity:
+- DenseDSU / HashedDSU: O(α(n)) amortized per operation (plus one hash lookup)
+- ConcurrentDSU: O(log n) expected per operation, lock-free
+*/
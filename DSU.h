@@ -0,0 +1,283 @@
+#pragma once
+
+#include<bits/stdc++.h>
+
+/**
+ * Header-only Disjoint Set Union library shared across modules
+ *
+ * Three backends:
+ * - DenseDSU<I>:   elements are 0..n-1 of index type I, parent and size live in flat vectors
+ * - HashedDSU<K>:  arbitrary keys, interned once to dense ids on top of DenseDSU
+ * - ConcurrentDSU: dense elements, lock-free find/union from any number of threads
+ *
+ * The sequential backends share find / unionBySize / connected / componentSize.
+ * ConcurrentDSU links by random priority instead of size, so its union is unionSets.
+ *
+ * Time Complexity: find / unionBySize / connected are O(α(n)) amortized for the
+ * sequential backends. find never recurses, so long chains cannot overflow the stack.
+ *
+ * See DSU.cpp for tests and benchmarks of every backend.
+ */
+
+/**
+ * Dense-array DSU over elements 0..n-1
+ *
+ * - Path halving: every node on the find path is re-pointed to its grandparent, in a
+ *   single iterative pass with no second walk and no recursion.
+ * - Union by size: the smaller tree goes under the root of the larger one.
+ *
+ * Index is the element id type: int by default, uint32_t for more than 2^31 elements.
+ */
+template <typename Index = int>
+class DenseDSU {
+private:
+    std::vector<Index> parent; // parent[x] == x for a root
+    std::vector<Index> size;   // size[root] = number of elements in its set
+    Index components = 0;
+
+public:
+    DenseDSU(Index n = 0) {
+        reserve(n);
+        for (Index i = 0; i < n; i++) add();
+    }
+
+    void reserve(Index n) {
+        parent.reserve(n);
+        size.reserve(n);
+    }
+
+    /**
+     * Adds a new singleton set
+     * @return: id of the new element
+     */
+    Index add() {
+        Index id = parent.size();
+        parent.push_back(id);
+        size.push_back(1);
+        components++;
+        return id;
+    }
+
+    Index find(Index x) {
+        while (parent[x] != x) {
+            parent[x] = parent[parent[x]];
+            x = parent[x];
+        }
+        return x;
+    }
+
+    /**
+     * @return: true if x and y were in different sets and are now merged
+     */
+    bool unionBySize(Index x, Index y) {
+        Index rootX = find(x);
+        Index rootY = find(y);
+        if (rootX == rootY) {
+            return false;
+        }
+        if (size[rootX] < size[rootY]) {
+            std::swap(rootX, rootY);
+        }
+        parent[rootY] = rootX;
+        size[rootX] += size[rootY];
+        components--;
+        return true;
+    }
+
+    bool connected(Index x, Index y) {
+        return find(x) == find(y);
+    }
+
+    Index componentSize(Index x) {
+        return size[find(x)];
+    }
+
+    Index elementCount() const {
+        return parent.size();
+    }
+
+    Index componentCount() const {
+        return components;
+    }
+};
+
+/**
+ * Hash for pair keys such as grid points, std::hash has no pair specialization
+ */
+struct DSUPairHash {
+    template <typename A, typename B>
+    size_t operator()(const std::pair<A, B>& p) const {
+        uint64_t h = (uint64_t)std::hash<A>()(p.first) * 0x9E3779B97F4A7C15ULL;
+        return h ^ (std::hash<B>()(p.second) + 0x632BE59BD9B4E019ULL + (h << 6) + (h >> 2));
+    }
+};
+
+/**
+ * DSU over arbitrary keys
+ *
+ * Each key is looked up in the hash map once per call and then handled as a dense id,
+ * so the find path itself only touches the flat DenseDSU arrays.
+ * Like the original VersionCompatibility DSU, find / unionBySize / connected add
+ * unknown keys as singleton sets.
+ */
+template <typename Key, typename Hash = std::hash<Key>>
+class HashedDSU {
+private:
+    std::unordered_map<Key, int, Hash> idOf; // key -> dense id
+    std::vector<Key> keys;                   // dense id -> key
+    DenseDSU<> dsu;
+
+    int idFor(const Key& key) {
+        auto it = idOf.find(key);
+        if (it != idOf.end()) {
+            return it->second;
+        }
+        int id = dsu.add();
+        idOf.emplace(key, id);
+        keys.push_back(key);
+        return id;
+    }
+
+public:
+    void reserve(int n) {
+        idOf.reserve(n);
+        keys.reserve(n);
+        dsu.reserve(n);
+    }
+
+    /**
+     * Adds key as a singleton set if it is not present yet
+     * @return: true if the key was new
+     */
+    bool add(const Key& key) {
+        size_t before = keys.size();
+        idFor(key);
+        return keys.size() != before;
+    }
+
+    bool contains(const Key& key) const {
+        return idOf.count(key) != 0;
+    }
+
+    Key find(const Key& key) {
+        return keys[dsu.find(idFor(key))];
+    }
+
+    bool unionBySize(const Key& x, const Key& y) {
+        int idX = idFor(x);
+        return dsu.unionBySize(idX, idFor(y));
+    }
+
+    bool connected(const Key& x, const Key& y) {
+        int idX = idFor(x);
+        return dsu.connected(idX, idFor(y));
+    }
+
+    int componentSize(const Key& key) {
+        return dsu.componentSize(idFor(key));
+    }
+
+    int componentCount() const {
+        return dsu.componentCount();
+    }
+
+    /**
+     * All keys in insertion order
+     */
+    const std::vector<Key>& elements() const {
+        return keys;
+    }
+};
+
+/**
+ * Lock-free concurrent DSU over elements 0..n-1 (Anderson–Woll style)
+ *
+ * - Every element has a fixed pseudo-random priority, and a root is only ever
+ *   linked under a root of higher (priority, id). Parent pointers therefore always
+ *   point up in that order, so concurrent links can never form a cycle.
+ * - unionSets links with one CAS on the lower root's parent, which succeeds only if
+ *   that element is still a root. On failure both roots are found again.
+ * - find does path halving with CAS. A failed CAS only means another thread already
+ *   moved the pointer further up, so it is simply skipped.
+ * - There is no size array: randomized linking already keeps trees shallow in
+ *   expectation, and sizes would need a second CAS per union.
+ */
+class ConcurrentDSU {
+private:
+    std::unique_ptr<std::atomic<uint32_t>[]> parent;
+    uint32_t count;
+
+    static uint64_t priority(uint32_t x) {
+        uint64_t z = x + 0x9E3779B97F4A7C15ULL;
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+        return z ^ (z >> 31);
+    }
+
+    static bool ranksBelow(uint32_t a, uint32_t b) {
+        uint64_t pa = priority(a), pb = priority(b);
+        return pa < pb || (pa == pb && a < b);
+    }
+
+public:
+    ConcurrentDSU(uint32_t n) : parent(new std::atomic<uint32_t>[n]), count(n) {
+        for (uint32_t i = 0; i < n; i++) {
+            parent[i].store(i, std::memory_order_relaxed);
+        }
+    }
+
+    uint32_t find(uint32_t x) {
+        while (true) {
+            uint32_t p = parent[x].load(std::memory_order_acquire);
+            if (p == x) {
+                return x;
+            }
+            uint32_t grandparent = parent[p].load(std::memory_order_acquire);
+            if (p != grandparent) {
+                parent[x].compare_exchange_weak(p, grandparent, std::memory_order_release, std::memory_order_relaxed);
+            }
+            x = p;
+        }
+    }
+
+    /**
+     * @return: true if this call merged two different sets
+     */
+    bool unionSets(uint32_t x, uint32_t y) {
+        while (true) {
+            x = find(x);
+            y = find(y);
+            if (x == y) {
+                return false;
+            }
+            if (ranksBelow(y, x)) {
+                std::swap(x, y);
+            }
+            uint32_t expected = x;
+            if (parent[x].compare_exchange_strong(expected, y, std::memory_order_acq_rel, std::memory_order_relaxed)) {
+                return true;
+            }
+        }
+    }
+
+    /**
+     * Linearizable: x's root is re-checked after the two finds, because a concurrent
+     * union may have linked it away in between.
+     */
+    bool connected(uint32_t x, uint32_t y) {
+        while (true) {
+            x = find(x);
+            y = find(y);
+            if (x == y) {
+                return true;
+            }
+            if (parent[x].load(std::memory_order_acquire) == x) {
+                return false;
+            }
+        }
+    }
+
+    uint32_t elementCount() const {
+        return count;
+    }
+};
@@ -0,0 +1,364 @@
+#include <iostream>
+#include <vector>
+#include <queue>
+#include <set>
+#include <random>
+#include <chrono>
+#include <cassert>
+#include <cstdint>
+#include <stdexcept>
+using namespace std;
+
+enum FieldValue { WHITE, BLACK, EMPTY };
+
+// Same as DetectCapturedStonesInGoGame.cpp, kept here as the benchmark baseline
+class Board {
+private:
+    vector<vector<FieldValue>> grid;
+    int size;
+
+public:
+    Board(int boardSize) : size(boardSize) {
+        grid = vector<vector<FieldValue>>(size, vector<FieldValue>(size, EMPTY));
+    }
+
+    FieldValue getValue(int x, int y) {
+        if (x < 0 || y < 0 || x >= size || y >= size) {
+            return EMPTY; // Borderless - treat out-of-bounds as empty
+        }
+        return grid[x][y];
+    }
+
+    void setValue(int x, int y, FieldValue value) {
+        if (x >= 0 && y >= 0 && x < size && y < size) {
+            grid[x][y] = value;
+        }
+    }
+};
+
+class StoneCaptureChecker {
+private:
+    Board* board;
+    int dx[4] = {-1, 1, 0, 0};
+    int dy[4] = {0, 0, -1, 1};
+
+public:
+    StoneCaptureChecker(Board* gameBoard) : board(gameBoard) {}
+
+    bool isCaptured(int x, int y) {
+        FieldValue stoneColor = board->getValue(x, y);
+        if (stoneColor == EMPTY) {
+            return false;
+        }
+        queue<pair<int, int>> toVisit;
+        set<pair<int, int>> visited;
+        toVisit.push({x, y});
+        while (!toVisit.empty()) {
+            auto [currentX, currentY] = toVisit.front();
+            toVisit.pop();
+            if (visited.count({currentX, currentY})) {
+                continue;
+            }
+            visited.insert({currentX, currentY});
+            for (int i = 0; i < 4; i++) {
+                int newX = currentX + dx[i];
+                int newY = currentY + dy[i];
+                FieldValue neighborValue = board->getValue(newX, newY);
+                if (neighborValue == EMPTY) {
+                    return false;
+                }
+                if (neighborValue == stoneColor && !visited.count({newX, newY})) {
+                    toVisit.push({newX, newY});
+                }
+            }
+        }
+        return true;
+    }
+};
+
+// Board stored as one 64-bit word per row and color. Row x of the board is word x + 1
+// and column y is bit y + 1, so every board cell has a padding row / bit on each side.
+// Padding never holds a stone, which makes off-board neighbours read as empty, the same
+// borderless rule as Board::getValue, without any bounds check.
+//
+// Capture detection grows a group mask with shift/and/or over whole rows: one step ORs
+// each row with itself shifted left and right and with the rows above and below, then
+// ANDs with the group's color. 64 cells of a row advance per instruction, instead of one
+// cell per queue pop as in the BFS checker.
+class BitboardGoBoard {
+private:
+    int size;
+    vector<uint64_t> stones[2]; // Indexed by WHITE / BLACK, size + 2 rows
+    vector<uint64_t> group;     // Flood-fill scratch, all zero between calls
+
+    void checkOnBoard(int x, int y) const {
+        if (x < 0 || y < 0 || x >= size || y >= size) {
+            throw out_of_range("Position is off the board");
+        }
+    }
+
+    // Fills `group` with the chain through (row, bit) in the `color` bitboard. Stops early
+    // and returns true as soon as the chain touches an empty point. Rows [lo, hi] of
+    // `group` are left set for the caller, which must clear them.
+    bool floodFill(int row, uint64_t bit, FieldValue color, int& lo, int& hi) {
+        const vector<uint64_t>& own = stones[color];
+        const vector<uint64_t>& other = stones[1 - color];
+        group[row] = bit;
+        lo = hi = row;
+        bool changed = true;
+        while (changed) {
+            changed = false;
+            int from = max(lo - 1, 1), to = min(hi + 1, size);
+            // Updating in place lets a change ripple down several rows in one sweep
+            for (int r = from; r <= to; r++) {
+                uint64_t grown = group[r] | group[r] << 1 | group[r] >> 1 | group[r - 1] | group[r + 1];
+                if (grown & ~(own[r] | other[r])) {
+                    return true;
+                }
+                grown &= own[r];
+                if (grown != group[r]) {
+                    group[r] = grown;
+                    changed = true;
+                    lo = min(lo, r);
+                    hi = max(hi, r);
+                }
+            }
+            // The padding rows are always empty, so a group on the first or last row is free
+            if (group[1] | group[size]) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void clearGroup(int lo, int hi) {
+        for (int r = lo; r <= hi; r++) {
+            group[r] = 0;
+        }
+    }
+
+public:
+    BitboardGoBoard(int boardSize) : size(boardSize) {
+        if (boardSize < 1 || boardSize > 62) {
+            throw invalid_argument("Board size must be between 1 and 62");
+        }
+        stones[WHITE].assign(size + 2, 0);
+        stones[BLACK].assign(size + 2, 0);
+        group.assign(size + 2, 0);
+    }
+
+    FieldValue getValue(int x, int y) const {
+        if (x < 0 || y < 0 || x >= size || y >= size) {
+            return EMPTY;
+        }
+        uint64_t bit = 1ULL << (y + 1);
+        if (stones[WHITE][x + 1] & bit) return WHITE;
+        if (stones[BLACK][x + 1] & bit) return BLACK;
+        return EMPTY;
+    }
+
+    void setValue(int x, int y, FieldValue value) {
+        if (x < 0 || y < 0 || x >= size || y >= size) {
+            return;
+        }
+        uint64_t bit = 1ULL << (y + 1);
+        stones[WHITE][x + 1] &= ~bit;
+        stones[BLACK][x + 1] &= ~bit;
+        if (value != EMPTY) {
+            stones[value][x + 1] |= bit;
+        }
+    }
+
+    bool isCaptured(int x, int y) {
+        FieldValue color = getValue(x, y);
+        if (color == EMPTY) {
+            return false;
+        }
+        int lo, hi;
+        bool hasLiberty = floodFill(x + 1, 1ULL << (y + 1), color, lo, hi);
+        clearGroup(lo, hi);
+        return !hasLiberty;
+    }
+
+    // Places a stone and lifts the opposing neighbour groups left without liberties.
+    // Returns the number of captured stones.
+    int playMove(int x, int y, FieldValue color) {
+        checkOnBoard(x, y);
+        if (color == EMPTY || getValue(x, y) != EMPTY) {
+            return 0;
+        }
+        setValue(x, y, color);
+        FieldValue opponent = color == WHITE ? BLACK : WHITE;
+        const int dx[4] = {-1, 1, 0, 0}, dy[4] = {0, 0, -1, 1};
+        int captured = 0;
+        for (int i = 0; i < 4; i++) {
+            int nx = x + dx[i], ny = y + dy[i];
+            if (getValue(nx, ny) != opponent) {
+                continue;
+            }
+            int lo, hi;
+            if (!floodFill(nx + 1, 1ULL << (ny + 1), opponent, lo, hi)) {
+                for (int r = lo; r <= hi; r++) {
+                    stones[opponent][r] &= ~group[r];
+                    captured += __builtin_popcountll(group[r]);
+                }
+            }
+            clearGroup(lo, hi);
+        }
+        return captured;
+    }
+};
+
+double elapsedMs(chrono::steady_clock::time_point start) {
+    return chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+}
+
+// Perft-style count: `games` random playouts of `movesPerGame` attempted moves each on
+// a size x size board. A move picks a random point and is skipped when it is occupied,
+// so both boards see the same move sequence. After each move the four neighbours are
+// checked for capture and captured groups are lifted.
+void benchmarkPlayouts(int size, int games, int movesPerGame) {
+    const int dx[4] = {-1, 1, 0, 0}, dy[4] = {0, 0, -1, 1};
+    vector<pair<int, int>> moves(movesPerGame);
+
+    double bitboardMs = 0, bfsMs = 0;
+    long long bitboardCaptures = 0, bfsCaptures = 0;
+    for (int game = 0; game < games; game++) {
+        mt19937 rng(game);
+        for (auto& [x, y] : moves) x = rng() % size, y = rng() % size;
+
+        auto start = chrono::steady_clock::now();
+        BitboardGoBoard bitboard(size);
+        for (int m = 0; m < movesPerGame; m++) {
+            bitboardCaptures += bitboard.playMove(moves[m].first, moves[m].second, m % 2 ? WHITE : BLACK);
+        }
+        bitboardMs += elapsedMs(start);
+
+        start = chrono::steady_clock::now();
+        Board board(size);
+        StoneCaptureChecker checker(&board);
+        for (int m = 0; m < movesPerGame; m++) {
+            auto [x, y] = moves[m];
+            FieldValue color = m % 2 ? WHITE : BLACK;
+            if (board.getValue(x, y) != EMPTY) continue;
+            board.setValue(x, y, color);
+            for (int i = 0; i < 4; i++) {
+                int nx = x + dx[i], ny = y + dy[i];
+                FieldValue neighbor = board.getValue(nx, ny);
+                if (neighbor == EMPTY || neighbor == color || !checker.isCaptured(nx, ny)) continue;
+                queue<pair<int, int>> fill;
+                fill.push({nx, ny});
+                board.setValue(nx, ny, EMPTY);
+                while (!fill.empty()) {
+                    auto [cx, cy] = fill.front();
+                    fill.pop();
+                    bfsCaptures++;
+                    for (int j = 0; j < 4; j++) {
+                        if (board.getValue(cx + dx[j], cy + dy[j]) == neighbor) {
+                            board.setValue(cx + dx[j], cy + dy[j], EMPTY);
+                            fill.push({cx + dx[j], cy + dy[j]});
+                        }
+                    }
+                }
+            }
+        }
+        bfsMs += elapsedMs(start);
+    }
+
+    cout << "Random playouts on " << size << "x" << size << ", " << games << " games of " << movesPerGame << " moves" << endl;
+    cout << "  BFS checker: " << games / bfsMs * 1000 << " playouts/s (captured stones " << bfsCaptures << ")" << endl;
+    cout << "  Bitboard:    " << games / bitboardMs * 1000 << " playouts/s (captured stones " << bitboardCaptures << ")" << endl;
+}
+
+int main() {
+    BitboardGoBoard gameBoard(10);
+
+    cout << "=== Bitboard Stone Capture Tests ===\n" << endl;
+
+    cout << "Test 1: Single white stone surrounded by black" << endl;
+    gameBoard.setValue(5, 5, WHITE);
+    gameBoard.setValue(4, 5, BLACK);
+    gameBoard.setValue(6, 5, BLACK);
+    gameBoard.setValue(5, 4, BLACK);
+    gameBoard.setValue(5, 6, BLACK);
+    cout << "Result: " << (gameBoard.isCaptured(5, 5) ? "CAPTURED" : "FREE") << endl << endl;
+
+    cout << "Test 2: White group with escape route" << endl;
+    gameBoard = BitboardGoBoard(10);
+    gameBoard.setValue(5, 5, WHITE);
+    gameBoard.setValue(5, 6, WHITE);
+    gameBoard.setValue(4, 5, BLACK);
+    gameBoard.setValue(6, 5, BLACK);
+    gameBoard.setValue(5, 4, BLACK);
+    gameBoard.setValue(4, 6, BLACK);
+    gameBoard.setValue(6, 6, BLACK);
+    cout << "Result: " << (gameBoard.isCaptured(5, 5) ? "CAPTURED" : "FREE") << endl << endl;
+
+    cout << "Test 3: White group fully captured" << endl;
+    gameBoard.setValue(5, 7, BLACK);
+    cout << "Result: " << (gameBoard.isCaptured(5, 5) ? "CAPTURED" : "FREE") << endl << endl;
+
+    // Random positions at every width the padding has to handle, checked cell by cell
+    for (int size : {1, 2, 9, 19, 62}) {
+        mt19937 rng(size);
+        Board reference(size);
+        StoneCaptureChecker checker(&reference);
+        BitboardGoBoard bitboard(size);
+        for (int round = 0; round < 20; round++) {
+            for (int x = 0; x < size; x++) {
+                for (int y = 0; y < size; y++) {
+                    int roll = rng() % 10;
+                    FieldValue value = roll < 1 ? EMPTY : roll < 5 ? WHITE : BLACK;
+                    reference.setValue(x, y, value);
+                    bitboard.setValue(x, y, value);
+                }
+            }
+            for (int x = 0; x < size; x++) {
+                for (int y = 0; y < size; y++) {
+                    assert(bitboard.getValue(x, y) == reference.getValue(x, y));
+                    assert(bitboard.isCaptured(x, y) == checker.isCaptured(x, y));
+                }
+            }
+        }
+    }
+    cout << "Bitboard matches the BFS checker" << endl << endl;
+
+    benchmarkPlayouts(9, 20000, 200);
+    benchmarkPlayouts(19, 5000, 800);
+    benchmarkPlayouts(61, 200, 8000);
+    return 0;
+}
+
+/*
+=== PROBLEM STATEMENT ===
+
+Same as DetectCapturedStonesInGoGame.cpp. Board keeps a vector<vector<FieldValue>>,
+every getValue bounds-checks, and StoneCaptureChecker walks a group one cell at a time
+with a queue and a set<pair<int,int>>. Random playouts need many capture checks per
+second.
+
+=== APPROACH ===
+
+Bitboards: one uint64_t per row for white and one for black. Board row x lives in word
+x + 1 and column y in bit y + 1. Row 0, row size + 1, bit 0 and bit size + 1 are padding
+that never holds a stone. Padding reads as empty, which is exactly the borderless rule,
+so no step needs a bounds check.
+
+Capture check for the group through (x, y):
+1. group = that single bit.
+2. For each row in the group's span +-1:
+   grown = group[r] | group[r] << 1 | group[r] >> 1 | group[r - 1] | group[r + 1]
+   - grown & ~(white[r] | black[r]) != 0  ->  an empty neighbour, group is free.
+   - group[r] = grown & ownColor[r]
+3. Repeat until no row changes. If that happens with no empty neighbour, the group is
+   captured and `group` is its exact stone mask.
+
+Capturing a group is then stones[opponent][r] &= ~group[r] per row.
+
+Board sizes up to 62x62 fit one word per row with the padding bits.
+
+=== COMPLEXITY ===
+- One sweep: O(rows spanned) word operations, 64 cells each
+- Sweeps: at most the group's path length, usually a handful, with an early exit on
+  the first liberty
+*/
@@ -0,0 +1,470 @@
+#include <iostream>
+#include <vector>
+#include <queue>
+#include <set>
+#include <unordered_map>
+#include <random>
+#include <chrono>
+#include <cassert>
+#include <cstdint>
+using namespace std;
+
+enum FieldValue { WHITE, BLACK, EMPTY };
+
+// Board from DetectCapturedStonesInGoGame.cpp, plus a Zobrist hash of the position.
+// Every (cell, color) pair owns a random 64-bit key and the hash is the XOR of the keys
+// of all stones on the board, so setValue updates it with at most two XORs and a
+// position reached through different move orders gets the same hash.
+class Board {
+private:
+    vector<vector<FieldValue>> grid;
+    int size;
+    vector<uint64_t> zobrist; // (x * size + y) * 2 + color
+    uint64_t hash = 0;
+
+public:
+    Board(int boardSize) : size(boardSize) {
+        grid = vector<vector<FieldValue>>(size, vector<FieldValue>(size, EMPTY));
+        mt19937_64 rng(0x5eed);
+        zobrist.resize(size * size * 2);
+        for (uint64_t& key : zobrist) {
+            key = rng();
+        }
+    }
+
+    FieldValue getValue(int x, int y) {
+        if (x < 0 || y < 0 || x >= size || y >= size) {
+            return EMPTY; // Borderless - treat out-of-bounds as empty
+        }
+        return grid[x][y];
+    }
+
+    void setValue(int x, int y, FieldValue value) {
+        if (x >= 0 && y >= 0 && x < size && y < size) {
+            int cell = x * size + y;
+            if (grid[x][y] != EMPTY) hash ^= zobrist[cell * 2 + grid[x][y]];
+            if (value != EMPTY) hash ^= zobrist[cell * 2 + value];
+            grid[x][y] = value;
+        }
+    }
+
+    uint64_t getHash() const {
+        return hash;
+    }
+
+    int getSize() const {
+        return size;
+    }
+};
+
+// Same as DetectCapturedStonesInGoGame.cpp, kept here as the benchmark baseline
+class StoneCaptureChecker {
+private:
+    Board* board;
+    int dx[4] = {-1, 1, 0, 0};
+    int dy[4] = {0, 0, -1, 1};
+
+public:
+    StoneCaptureChecker(Board* gameBoard) : board(gameBoard) {}
+
+    bool isCaptured(int x, int y) {
+        FieldValue stoneColor = board->getValue(x, y);
+        if (stoneColor == EMPTY) {
+            return false;
+        }
+        queue<pair<int, int>> toVisit;
+        set<pair<int, int>> visited;
+        toVisit.push({x, y});
+        while (!toVisit.empty()) {
+            auto [currentX, currentY] = toVisit.front();
+            toVisit.pop();
+            if (visited.count({currentX, currentY})) {
+                continue;
+            }
+            visited.insert({currentX, currentY});
+            for (int i = 0; i < 4; i++) {
+                int newX = currentX + dx[i];
+                int newY = currentY + dy[i];
+                FieldValue neighborValue = board->getValue(newX, newY);
+                if (neighborValue == EMPTY) {
+                    return false;
+                }
+                if (neighborValue == stoneColor && !visited.count({newX, newY})) {
+                    toVisit.push({newX, newY});
+                }
+            }
+        }
+        return true;
+    }
+};
+
+// Fixed-capacity map from (position hash, cell) to a capture result, evicting with the
+// CLOCK policy: every entry has a referenced bit that a hit sets, and on a miss the hand
+// sweeps the ring, clearing referenced bits until it finds an entry without one. That
+// approximates LRU with no list splicing on hits.
+class CaptureCache {
+private:
+    struct Entry {
+        uint64_t hash;
+        int cell;
+        bool captured;
+        bool referenced;
+    };
+
+    vector<Entry> entries;
+    unordered_map<uint64_t, int> slotOf; // mixed key -> index in entries
+    size_t capacity;
+    size_t hand = 0;
+
+    static uint64_t mix(uint64_t hash, int cell) {
+        return hash ^ ((uint64_t)(cell + 1) * 0x9E3779B97F4A7C15ULL);
+    }
+
+public:
+    long long hits = 0, misses = 0;
+
+    CaptureCache(size_t capacity) : capacity(capacity) {
+        entries.reserve(capacity);
+        slotOf.reserve(capacity);
+    }
+
+    // Returns 1 / 0 for a cached result, -1 when absent
+    int lookup(uint64_t hash, int cell) {
+        auto it = slotOf.find(mix(hash, cell));
+        if (it != slotOf.end()) {
+            Entry& entry = entries[it->second];
+            if (entry.hash == hash && entry.cell == cell) {
+                entry.referenced = true;
+                hits++;
+                return entry.captured;
+            }
+        }
+        misses++;
+        return -1;
+    }
+
+    void insert(uint64_t hash, int cell, bool captured) {
+        uint64_t key = mix(hash, cell);
+        auto it = slotOf.find(key);
+        if (it != slotOf.end()) {
+            entries[it->second] = {hash, cell, captured, true};
+            return;
+        }
+        int slot;
+        if (entries.size() < capacity) {
+            slot = entries.size();
+            entries.push_back({hash, cell, captured, false});
+        } else {
+            while (entries[hand].referenced) {
+                entries[hand].referenced = false;
+                hand = (hand + 1) % capacity;
+            }
+            slot = hand;
+            hand = (hand + 1) % capacity;
+            slotOf.erase(mix(entries[slot].hash, entries[slot].cell));
+            entries[slot] = {hash, cell, captured, false};
+        }
+        slotOf[key] = slot;
+    }
+
+    double hitRate() const {
+        return hits + misses == 0 ? 0 : (double)hits / (hits + misses);
+    }
+};
+
+struct GroupStatus {
+    int rootX, rootY; // First stone of the group in row-major order
+    int stones;
+    bool captured;
+};
+
+// Capture checks that remember results per position, keyed by the Zobrist hash and a
+// stone. isCaptured caches under the queried stone: finding the group root would take
+// a walk of the whole group, while a miss can stop at the first liberty. checkAllGroups
+// walks every group anyway and caches each result under the group root (the group's
+// first stone in row-major order), which later queries on that stone hit.
+class CachedCaptureChecker {
+private:
+    Board* board;
+    CaptureCache cache;
+    vector<int> visitedStamp; // visitedStamp[cell] == stamp marks cells seen in this walk
+    vector<int> queue;
+    int stamp = 0;
+
+    // Walks the group through (x, y) and returns whether it is captured. With
+    // stopAtLiberty the walk ends at the first liberty; otherwise it covers the whole
+    // group and sets root to its smallest cell and stones to its size.
+    bool walkGroup(int x, int y, bool stopAtLiberty, int& root, int& stones) {
+        const int dx[4] = {-1, 1, 0, 0}, dy[4] = {0, 0, -1, 1};
+        int size = board->getSize();
+        FieldValue color = board->getValue(x, y);
+        stamp++;
+        queue.clear();
+        queue.push_back(x * size + y);
+        visitedStamp[x * size + y] = stamp;
+        root = x * size + y;
+        bool captured = true;
+        for (size_t head = 0; head < queue.size(); head++) {
+            int cell = queue[head], cx = cell / size, cy = cell % size;
+            root = min(root, cell);
+            for (int i = 0; i < 4; i++) {
+                int nx = cx + dx[i], ny = cy + dy[i];
+                FieldValue neighbor = board->getValue(nx, ny);
+                if (neighbor == EMPTY) {
+                    captured = false;
+                    if (stopAtLiberty) return false;
+                } else if (neighbor == color && visitedStamp[nx * size + ny] != stamp) {
+                    visitedStamp[nx * size + ny] = stamp;
+                    queue.push_back(nx * size + ny);
+                }
+            }
+        }
+        stones = queue.size();
+        return captured;
+    }
+
+public:
+    CachedCaptureChecker(Board* gameBoard, size_t cacheCapacity)
+        : board(gameBoard), cache(cacheCapacity), visitedStamp(gameBoard->getSize() * gameBoard->getSize(), 0) {}
+
+    bool isCaptured(int x, int y) {
+        if (board->getValue(x, y) == EMPTY) {
+            return false;
+        }
+        uint64_t hash = board->getHash();
+        int cell = x * board->getSize() + y;
+        int cached = cache.lookup(hash, cell);
+        if (cached != -1) {
+            return cached;
+        }
+        int root, stones;
+        bool captured = walkGroup(x, y, true, root, stones);
+        cache.insert(hash, cell, captured);
+        return captured;
+    }
+
+    // Every group on the board in one row-major pass: each stone is visited once, by the
+    // walk of the group it belongs to. Results go to the cache under the group roots.
+    vector<GroupStatus> checkAllGroups() {
+        int size = board->getSize();
+        uint64_t hash = board->getHash();
+        int passStart = stamp + 1;
+        vector<GroupStatus> groups;
+        for (int x = 0; x < size; x++) {
+            for (int y = 0; y < size; y++) {
+                if (board->getValue(x, y) == EMPTY || visitedStamp[x * size + y] >= passStart) {
+                    continue;
+                }
+                int root, stones;
+                bool captured = walkGroup(x, y, false, root, stones);
+                cache.insert(hash, root, captured);
+                groups.push_back({x, y, stones, captured});
+            }
+        }
+        return groups;
+    }
+
+    const CaptureCache& stats() const {
+        return cache;
+    }
+};
+
+double elapsedMs(chrono::steady_clock::time_point start) {
+    return chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+}
+
+// Analysis-style workload on a crowded board: explore `branches` random lines of `depth`
+// moves, each move toggling one of `candidateCount` points between empty and a stone,
+// query isCaptured at points of a fixed region after each move, then undo the line.
+// Different move orders reach the same positions, so positions repeat across branches.
+void benchmarkBranches(int size, int branches, int depth, int candidateCount, int queriesPerNode, size_t capacity) {
+    mt19937 rng(7);
+    Board board(size);
+    for (int x = 0; x < size; x++) {
+        for (int y = 0; y < size; y++) {
+            int roll = rng() % 20;
+            board.setValue(x, y, roll < 1 ? EMPTY : roll < 10 ? WHITE : BLACK);
+        }
+    }
+    vector<pair<int, int>> candidates(candidateCount), region(64);
+    vector<FieldValue> stoneOf(candidateCount);
+    for (auto& [x, y] : candidates) x = rng() % size, y = rng() % size;
+    for (FieldValue& color : stoneOf) color = rng() % 2 ? WHITE : BLACK;
+    for (auto& [x, y] : region) x = rng() % size, y = rng() % size;
+
+    // Fixed script so both checkers answer exactly the same queries
+    struct Step {
+        int x, y;
+        FieldValue value;
+        vector<pair<int, int>> queries;
+    };
+    vector<vector<Step>> lines(branches);
+    for (auto& line : lines) {
+        for (int d = 0; d < depth; d++) {
+            Step step;
+            int pick = rng() % candidateCount;
+            step.x = candidates[pick].first, step.y = candidates[pick].second;
+            step.value = rng() % 2 ? EMPTY : stoneOf[pick];
+            for (int q = 0; q < queriesPerNode; q++) step.queries.push_back(region[rng() % region.size()]);
+            line.push_back(step);
+        }
+    }
+
+    auto run = [&](auto& checker) {
+        long long captured = 0;
+        for (auto& line : lines) {
+            vector<FieldValue> undo;
+            for (Step& step : line) {
+                undo.push_back(board.getValue(step.x, step.y));
+                board.setValue(step.x, step.y, step.value);
+                for (auto [qx, qy] : step.queries) captured += checker.isCaptured(qx, qy);
+            }
+            for (int d = depth - 1; d >= 0; d--) board.setValue(line[d].x, line[d].y, undo[d]);
+        }
+        return captured;
+    };
+
+    StoneCaptureChecker plain(&board);
+    auto start = chrono::steady_clock::now();
+    long long plainCaptured = run(plain);
+    double plainMs = elapsedMs(start);
+
+    CachedCaptureChecker cached(&board, capacity);
+    start = chrono::steady_clock::now();
+    long long cachedCaptured = run(cached);
+    double cachedMs = elapsedMs(start);
+
+    long long queries = (long long)branches * depth * queriesPerNode;
+    cout << "Branch exploration on " << size << "x" << size << ", " << queries << " queries, cache capacity " << capacity << endl;
+    cout << "  BFS checker: " << queries / plainMs / 1000 << " M queries/s (captured " << plainCaptured << ")" << endl;
+    cout << "  Cached:      " << queries / cachedMs / 1000 << " M queries/s (captured " << cachedCaptured
+         << ", hit rate " << cached.stats().hitRate() * 100 << "%)" << endl;
+}
+
+// checkAllGroups against isCaptured on every stone, on random positions
+void benchmarkBatch(int size, int positions) {
+    mt19937 rng(9);
+    Board board(size);
+    StoneCaptureChecker plain(&board);
+    CachedCaptureChecker cached(&board, 1 << 16);
+    double plainMs = 0, batchMs = 0;
+    long long plainCaptured = 0, batchCaptured = 0;
+    for (int p = 0; p < positions; p++) {
+        for (int x = 0; x < size; x++) {
+            for (int y = 0; y < size; y++) {
+                int roll = rng() % 10;
+                board.setValue(x, y, roll < 2 ? EMPTY : roll < 6 ? WHITE : BLACK);
+            }
+        }
+        auto start = chrono::steady_clock::now();
+        for (int x = 0; x < size; x++)
+            for (int y = 0; y < size; y++) plainCaptured += plain.isCaptured(x, y);
+        plainMs += elapsedMs(start);
+
+        start = chrono::steady_clock::now();
+        for (const GroupStatus& group : cached.checkAllGroups()) batchCaptured += group.captured ? group.stones : 0;
+        batchMs += elapsedMs(start);
+    }
+    cout << "All groups of " << positions << " random " << size << "x" << size << " positions" << endl;
+    cout << "  isCaptured per stone: " << positions / plainMs * 1000 << " positions/s (captured stones " << plainCaptured << ")" << endl;
+    cout << "  checkAllGroups:       " << positions / batchMs * 1000 << " positions/s (captured stones " << batchCaptured << ")" << endl;
+}
+
+int main() {
+    Board gameBoard(10);
+    CachedCaptureChecker checker(&gameBoard, 1024);
+
+    cout << "=== Cached Stone Capture Tests ===\n" << endl;
+
+    cout << "Test 1: Single white stone surrounded by black" << endl;
+    gameBoard.setValue(5, 5, WHITE);
+    gameBoard.setValue(4, 5, BLACK);
+    gameBoard.setValue(6, 5, BLACK);
+    gameBoard.setValue(5, 4, BLACK);
+    gameBoard.setValue(5, 6, BLACK);
+    cout << "Result: " << (checker.isCaptured(5, 5) ? "CAPTURED" : "FREE") << endl << endl;
+    uint64_t capturedPosition = gameBoard.getHash();
+
+    cout << "Test 2: White group with escape route" << endl;
+    gameBoard.setValue(5, 6, WHITE);
+    gameBoard.setValue(4, 6, BLACK);
+    gameBoard.setValue(6, 6, BLACK);
+    cout << "Result: " << (checker.isCaptured(5, 5) ? "CAPTURED" : "FREE") << endl << endl;
+
+    cout << "Test 3: White group fully captured" << endl;
+    gameBoard.setValue(5, 7, BLACK);
+    cout << "Result: " << (checker.isCaptured(5, 5) ? "CAPTURED" : "FREE") << endl;
+    for (const GroupStatus& group : checker.checkAllGroups()) {
+        cout << "  Group at (" << group.rootX << ", " << group.rootY << "), " << group.stones << " stone(s): "
+             << (group.captured ? "CAPTURED" : "FREE") << endl;
+    }
+    cout << endl;
+
+    // Undoing moves restores the earlier hash, whatever the order
+    gameBoard.setValue(6, 6, EMPTY);
+    gameBoard.setValue(5, 7, EMPTY);
+    gameBoard.setValue(4, 6, EMPTY);
+    gameBoard.setValue(5, 6, BLACK);
+    assert(gameBoard.getHash() == capturedPosition);
+    assert(checker.isCaptured(5, 5) == true);
+
+    // Random positions, single queries and the batch API against the BFS checker
+    int size = 9;
+    Board board(size);
+    StoneCaptureChecker reference(&board);
+    CachedCaptureChecker randomChecker(&board, 64);
+    mt19937 rng(3);
+    for (int step = 0; step < 3000; step++) {
+        board.setValue(rng() % size, rng() % size, (FieldValue)(rng() % 3));
+        int x = rng() % size, y = rng() % size;
+        assert(randomChecker.isCaptured(x, y) == reference.isCaptured(x, y));
+        if (step % 50 == 0) {
+            int stones = 0;
+            for (const GroupStatus& group : randomChecker.checkAllGroups()) {
+                assert(group.captured == reference.isCaptured(group.rootX, group.rootY));
+                stones += group.stones;
+            }
+            int expected = 0;
+            for (int i = 0; i < size; i++)
+                for (int j = 0; j < size; j++) expected += board.getValue(i, j) != EMPTY;
+            assert(stones == expected);
+        }
+    }
+    cout << "Cached checker matches the BFS checker" << endl << endl;
+
+    benchmarkBranches(19, 20000, 12, 8, 20, 1 << 16);
+    benchmarkBranches(19, 20000, 12, 8, 20, 1 << 10);
+    benchmarkBatch(19, 20000);
+    return 0;
+}
+
+/*
+=== PROBLEM STATEMENT ===
+
+Same as DetectCapturedStonesInGoGame.cpp. An analysis tool explores many branches
+from one position and asks isCaptured about the same positions again and again, each
+time paying a fresh BFS with a set<pair<int,int>> visited.
+
+=== APPROACH ===
+
+1. Zobrist hashing in Board::setValue: XOR out the key of the old stone, XOR in the key
+   of the new one. Undoing a line of moves returns the exact same hash.
+
+2. CaptureCache: fixed capacity, keyed by (position hash, cell), CLOCK eviction
+   (referenced bit set on hit, cleared by the sweeping hand) as a cheap LRU.
+
+3. CachedCaptureChecker::isCaptured
+   - lookup (hash, queried stone); a hit answers in O(1)
+   - miss: walk the group with a stamped visited array (no set, no allocation),
+     stopping at the first liberty, and store the result
+
+4. checkAllGroups: one row-major pass. Unvisited stones start a group walk, so every
+   stone is touched once and each group reports its root, size and captured flag. The
+   result is cached under (hash, root).
+
+=== COMPLEXITY ===
+- setValue: O(1) extra for the hash
+- isCaptured: O(1) on a hit, O(group) on a miss
+- checkAllGroups: O(board), versus O(sum of group sizes per stone) for isCaptured on
+  every stone
+*/
@@ -0,0 +1,502 @@
+#include <iostream>
+#include <vector>
+#include <queue>
+#include <set>
+#include <random>
+#include <chrono>
+#include <cassert>
+using namespace std;
+
+enum FieldValue { WHITE, BLACK, EMPTY };
+
+// Same as DetectCapturedStonesInGoGame.cpp, kept here as the benchmark baseline
+class Board {
+private:
+    vector<vector<FieldValue>> grid;
+    int size;
+
+public:
+    Board(int boardSize) : size(boardSize) {
+        grid = vector<vector<FieldValue>>(size, vector<FieldValue>(size, EMPTY));
+    }
+
+    FieldValue getValue(int x, int y) {
+        if (x < 0 || y < 0 || x >= size || y >= size) {
+            return EMPTY; // Borderless - treat out-of-bounds as empty
+        }
+        return grid[x][y];
+    }
+
+    void setValue(int x, int y, FieldValue value) {
+        if (x >= 0 && y >= 0 && x < size && y < size) {
+            grid[x][y] = value;
+        }
+    }
+};
+
+class StoneCaptureChecker {
+private:
+    Board* board;
+    int dx[4] = {-1, 1, 0, 0};
+    int dy[4] = {0, 0, -1, 1};
+
+public:
+    StoneCaptureChecker(Board* gameBoard) : board(gameBoard) {}
+
+    bool isCaptured(int x, int y) {
+        FieldValue stoneColor = board->getValue(x, y);
+        if (stoneColor == EMPTY) {
+            return false;
+        }
+        queue<pair<int, int>> toVisit;
+        set<pair<int, int>> visited;
+        toVisit.push({x, y});
+        while (!toVisit.empty()) {
+            auto [currentX, currentY] = toVisit.front();
+            toVisit.pop();
+            if (visited.count({currentX, currentY})) {
+                continue;
+            }
+            visited.insert({currentX, currentY});
+            for (int i = 0; i < 4; i++) {
+                int newX = currentX + dx[i];
+                int newY = currentY + dy[i];
+                FieldValue neighborValue = board->getValue(newX, newY);
+                if (neighborValue == EMPTY) {
+                    return false;
+                }
+                if (neighborValue == stoneColor && !visited.count({newX, newY})) {
+                    toVisit.push({newX, newY});
+                }
+            }
+        }
+        return true;
+    }
+};
+
+// Board that keeps every chain (connected same-colored group) up to date on each
+// setValue, so isCaptured is a union-find lookup instead of a flood fill.
+//
+// - Layout: one flat array with a one-cell off-board frame, so the neighbours of a cell
+//   are always cell +- 1 and cell +- stride, with no bounds checks.
+// - Chains: union-find over cells (union by size, path halving). Each chain also links
+//   its stones in a circular list (next[]), so a chain can be walked or spliced in O(1).
+// - Liberties: each chain root stores a pseudo-liberty count, the number of
+//   (stone, empty neighbour) pairs, counting a shared empty point once per adjacent
+//   stone. It is zero exactly when the chain has no liberty, and unlike an exact count
+//   it can be updated with +1/-1 per adjacent stone, without knowing which empty points
+//   are shared. Off-board neighbours count as liberties, as in Board::getValue.
+class IncrementalCaptureBoard {
+private:
+    static const uint8_t OFF_BOARD = EMPTY + 1;
+
+    int size, stride;
+    vector<uint8_t> cells; // (x + 1) * stride + (y + 1), frame cells hold OFF_BOARD
+    vector<int> parent, chainSize, next, pseudoLiberties;
+
+    int cellOf(int x, int y) const {
+        return (x + 1) * stride + (y + 1);
+    }
+
+    bool onBoard(int x, int y) const {
+        return x >= 0 && y >= 0 && x < size && y < size;
+    }
+
+    static bool isStone(uint8_t value) {
+        return value < EMPTY;
+    }
+
+    template <typename Visit>
+    void forEachNeighbor(int cell, Visit visit) const {
+        visit(cell - stride);
+        visit(cell + stride);
+        visit(cell - 1);
+        visit(cell + 1);
+    }
+
+    int find(int cell) {
+        while (parent[cell] != cell) {
+            parent[cell] = parent[parent[cell]];
+            cell = parent[cell];
+        }
+        return cell;
+    }
+
+    void unite(int a, int b) {
+        int rootA = find(a), rootB = find(b);
+        if (rootA == rootB) {
+            return;
+        }
+        if (chainSize[rootA] < chainSize[rootB]) {
+            swap(rootA, rootB);
+        }
+        parent[rootB] = rootA;
+        chainSize[rootA] += chainSize[rootB];
+        pseudoLiberties[rootA] += pseudoLiberties[rootB];
+        swap(next[rootA], next[rootB]); // Splice the two stone rings into one
+    }
+
+    // Makes cell a one-stone chain with its own liberties
+    void makeSingleton(int cell) {
+        parent[cell] = cell;
+        chainSize[cell] = 1;
+        next[cell] = cell;
+        int liberties = 0;
+        forEachNeighbor(cell, [&](int n) { liberties += !isStone(cells[n]); });
+        pseudoLiberties[cell] = liberties;
+    }
+
+    vector<int> chainStones(int cell) const {
+        vector<int> stones;
+        int current = cell;
+        do {
+            stones.push_back(current);
+            current = next[current];
+        } while (current != cell);
+        return stones;
+    }
+
+    void placeStone(int cell, FieldValue color) {
+        cells[cell] = color;
+        makeSingleton(cell);
+        // Every adjacent stone loses this point as a liberty
+        forEachNeighbor(cell, [&](int n) {
+            if (isStone(cells[n])) pseudoLiberties[find(n)]--;
+        });
+        forEachNeighbor(cell, [&](int n) {
+            if (cells[n] == color) unite(cell, n);
+        });
+    }
+
+    // Removing a stone may split its chain, so the rest of the chain is regrouped
+    // from scratch; cost is proportional to that chain only
+    void removeStone(int cell) {
+        vector<int> rest = chainStones(cell);
+        uint8_t color = cells[cell];
+        cells[cell] = EMPTY;
+        forEachNeighbor(cell, [&](int n) {
+            if (isStone(cells[n]) && cells[n] != color) pseudoLiberties[find(n)]++;
+        });
+        for (int stone : rest) {
+            makeSingleton(stone);
+        }
+        for (int stone : rest) {
+            if (stone == cell) continue;
+            forEachNeighbor(stone, [&](int n) {
+                if (cells[n] == color) unite(stone, n);
+            });
+        }
+    }
+
+public:
+    IncrementalCaptureBoard(int boardSize)
+        : size(boardSize), stride(boardSize + 2), cells(stride * stride, OFF_BOARD), parent(stride * stride),
+          chainSize(stride * stride, 1), next(stride * stride), pseudoLiberties(stride * stride, 0) {
+        for (int cell = 0; cell < stride * stride; cell++) {
+            parent[cell] = next[cell] = cell;
+        }
+        for (int x = 0; x < size; x++) {
+            fill(cells.begin() + cellOf(x, 0), cells.begin() + cellOf(x, size), (uint8_t)EMPTY);
+        }
+    }
+
+    FieldValue getValue(int x, int y) const {
+        return onBoard(x, y) ? (FieldValue)cells[cellOf(x, y)] : EMPTY;
+    }
+
+    // Cost is O(α(n)) to place a stone, plus the size of the stone's old chain when
+    // a stone is removed or recoloured
+    void setValue(int x, int y, FieldValue value) {
+        if (!onBoard(x, y)) {
+            return;
+        }
+        int cell = cellOf(x, y);
+        if (cells[cell] == value) {
+            return;
+        }
+        if (cells[cell] != EMPTY) {
+            removeStone(cell);
+        }
+        if (value != EMPTY) {
+            placeStone(cell, value);
+        }
+    }
+
+    // O(α(n)): a chain is captured when it has no pseudo-liberty left
+    bool isCaptured(int x, int y) {
+        if (getValue(x, y) == EMPTY) {
+            return false;
+        }
+        return pseudoLiberties[find(cellOf(x, y))] == 0;
+    }
+
+    // Places a stone and removes the opposing chains it captures, as a Go move does.
+    // Only the up to four neighbouring chains are examined, and only captured chains are
+    // walked. A self-capturing move stays on the board, isCaptured reports it.
+    // Returns the captured stones.
+    vector<pair<int, int>> playMove(int x, int y, FieldValue color) {
+        vector<pair<int, int>> captured;
+        if (color == EMPTY || getValue(x, y) != EMPTY || !onBoard(x, y)) {
+            return captured;
+        }
+        int cell = cellOf(x, y);
+        placeStone(cell, color);
+        forEachNeighbor(cell, [&](int n) {
+            // A chain already removed through another neighbour is EMPTY by now
+            if (!isStone(cells[n]) || cells[n] == color || pseudoLiberties[find(n)] != 0) {
+                return;
+            }
+            vector<int> chain = chainStones(n);
+            for (int stone : chain) {
+                cells[stone] = EMPTY;
+                captured.push_back({stone / stride - 1, stone % stride - 1});
+            }
+            // Emptied first so stones of the same chain are skipped here
+            for (int stone : chain) {
+                forEachNeighbor(stone, [&](int m) {
+                    if (isStone(cells[m])) pseudoLiberties[find(m)]++;
+                });
+            }
+            for (int stone : chain) {
+                makeSingleton(stone);
+            }
+        });
+        return captured;
+    }
+
+    int chainLength(int x, int y) {
+        return getValue(x, y) == EMPTY ? 0 : chainSize[find(cellOf(x, y))];
+    }
+};
+
+double elapsedMs(chrono::steady_clock::time_point start) {
+    return chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+}
+
+// Random self-play on empty points until the board is full or `movesPerGame` moves are
+// played. After every move the four neighbours are checked for capture and captured
+// groups are lifted. The BFS version does this with StoneCaptureChecker and a flood fill.
+void benchmarkPlayouts(int size, int games, int movesPerGame) {
+    const int dx[4] = {-1, 1, 0, 0}, dy[4] = {0, 0, -1, 1};
+    long long incrementalMoves = 0, incrementalCaptures = 0;
+    auto start = chrono::steady_clock::now();
+    for (int game = 0; game < games; game++) {
+        mt19937 rng(game);
+        IncrementalCaptureBoard board(size);
+        vector<pair<int, int>> empties;
+        for (int x = 0; x < size; x++) for (int y = 0; y < size; y++) empties.push_back({x, y});
+        for (int m = 0; m < movesPerGame && !empties.empty(); m++) {
+            int pick = rng() % empties.size();
+            auto [x, y] = empties[pick];
+            empties[pick] = empties.back();
+            empties.pop_back();
+            vector<pair<int, int>> captured = board.playMove(x, y, m % 2 ? WHITE : BLACK);
+            empties.insert(empties.end(), captured.begin(), captured.end());
+            incrementalCaptures += captured.size();
+            incrementalMoves++;
+        }
+    }
+    double incrementalMs = elapsedMs(start);
+
+    long long bfsMoves = 0, bfsCaptures = 0;
+    start = chrono::steady_clock::now();
+    for (int game = 0; game < games; game++) {
+        mt19937 rng(game);
+        Board board(size);
+        StoneCaptureChecker checker(&board);
+        vector<pair<int, int>> empties;
+        for (int x = 0; x < size; x++) for (int y = 0; y < size; y++) empties.push_back({x, y});
+        for (int m = 0; m < movesPerGame && !empties.empty(); m++) {
+            int pick = rng() % empties.size();
+            auto [x, y] = empties[pick];
+            empties[pick] = empties.back();
+            empties.pop_back();
+            FieldValue color = m % 2 ? WHITE : BLACK;
+            board.setValue(x, y, color);
+            for (int i = 0; i < 4; i++) {
+                int nx = x + dx[i], ny = y + dy[i];
+                FieldValue neighbor = board.getValue(nx, ny);
+                if (neighbor == EMPTY || neighbor == color || !checker.isCaptured(nx, ny)) continue;
+                queue<pair<int, int>> fill;
+                fill.push({nx, ny});
+                board.setValue(nx, ny, EMPTY);
+                while (!fill.empty()) {
+                    auto [cx, cy] = fill.front();
+                    fill.pop();
+                    empties.push_back({cx, cy});
+                    bfsCaptures++;
+                    for (int j = 0; j < 4; j++) {
+                        if (board.getValue(cx + dx[j], cy + dy[j]) == neighbor) {
+                            board.setValue(cx + dx[j], cy + dy[j], EMPTY);
+                            fill.push({cx + dx[j], cy + dy[j]});
+                        }
+                    }
+                }
+            }
+            bfsMoves++;
+        }
+    }
+    double bfsMs = elapsedMs(start);
+
+    cout << "Random playouts on " << size << "x" << size << ", " << games << " games" << endl;
+    cout << "  BFS checker: " << bfsMoves / bfsMs / 1000 << " M moves/s (moves " << bfsMoves << ", captured stones " << bfsCaptures << ")" << endl;
+    cout << "  Incremental: " << incrementalMoves / incrementalMs / 1000 << " M moves/s (moves " << incrementalMoves << ", captured stones " << incrementalCaptures << ")" << endl;
+}
+
+// A random position at the given stone density, then isCaptured for every cell,
+// `rounds` times over
+void benchmarkQueries(int size, int stonePercent, int rounds) {
+    Board board(size);
+    StoneCaptureChecker checker(&board);
+    IncrementalCaptureBoard incremental(size);
+    mt19937 rng(size);
+    for (int x = 0; x < size; x++) {
+        for (int y = 0; y < size; y++) {
+            if ((int)(rng() % 100) >= stonePercent) continue;
+            FieldValue color = rng() % 2 ? WHITE : BLACK;
+            board.setValue(x, y, color);
+            incremental.setValue(x, y, color);
+        }
+    }
+
+    auto start = chrono::steady_clock::now();
+    long long bfsCaptured = 0;
+    for (int r = 0; r < rounds; r++)
+        for (int x = 0; x < size; x++)
+            for (int y = 0; y < size; y++) bfsCaptured += checker.isCaptured(x, y);
+    double bfsMs = elapsedMs(start);
+
+    start = chrono::steady_clock::now();
+    long long incrementalCaptured = 0;
+    for (int r = 0; r < rounds; r++)
+        for (int x = 0; x < size; x++)
+            for (int y = 0; y < size; y++) incrementalCaptured += incremental.isCaptured(x, y);
+    double incrementalMs = elapsedMs(start);
+
+    long long queries = (long long)rounds * size * size;
+    cout << "isCaptured on every cell of a " << size << "x" << size << " board, " << stonePercent << "% stones" << endl;
+    cout << "  BFS checker: " << queries / bfsMs / 1000 << " M queries/s (captured " << bfsCaptured << ")" << endl;
+    cout << "  Incremental: " << queries / incrementalMs / 1000 << " M queries/s (captured " << incrementalCaptured << ")" << endl;
+}
+
+int main() {
+    IncrementalCaptureBoard gameBoard(10);
+
+    cout << "=== Incremental Stone Capture Tests ===\n" << endl;
+
+    cout << "Test 1: Single white stone surrounded by black" << endl;
+    gameBoard.setValue(5, 5, WHITE);
+    gameBoard.setValue(4, 5, BLACK);
+    gameBoard.setValue(6, 5, BLACK);
+    gameBoard.setValue(5, 4, BLACK);
+    gameBoard.setValue(5, 6, BLACK);
+    cout << "Result: " << (gameBoard.isCaptured(5, 5) ? "CAPTURED" : "FREE") << endl << endl;
+
+    cout << "Test 2: White group with escape route" << endl;
+    gameBoard = IncrementalCaptureBoard(10);
+    gameBoard.setValue(5, 5, WHITE);
+    gameBoard.setValue(5, 6, WHITE);
+    gameBoard.setValue(4, 5, BLACK);
+    gameBoard.setValue(6, 5, BLACK);
+    gameBoard.setValue(5, 4, BLACK);
+    gameBoard.setValue(4, 6, BLACK);
+    gameBoard.setValue(6, 6, BLACK);
+    cout << "Result: " << (gameBoard.isCaptured(5, 5) ? "CAPTURED" : "FREE") << endl << endl;
+
+    cout << "Test 3: White group fully captured" << endl;
+    gameBoard.setValue(5, 7, BLACK);
+    cout << "Result: " << (gameBoard.isCaptured(5, 5) ? "CAPTURED" : "FREE") << endl << endl;
+
+    cout << "Test 4: Removing a blocker frees the group again" << endl;
+    gameBoard.setValue(5, 7, EMPTY);
+    cout << "Result: " << (gameBoard.isCaptured(5, 6) ? "CAPTURED" : "FREE") << endl << endl;
+
+    cout << "Test 5: Black plays (5, 7) and captures the white group" << endl;
+    vector<pair<int, int>> captured = gameBoard.playMove(5, 7, BLACK);
+    cout << "Captured " << captured.size() << " stones, (5, 5) is now "
+         << (gameBoard.getValue(5, 5) == EMPTY ? "EMPTY" : "occupied") << endl << endl;
+
+    // Random edits, every stone checked against the BFS checker
+    int size = 9;
+    Board reference(size);
+    StoneCaptureChecker checker(&reference);
+    IncrementalCaptureBoard randomBoard(size);
+    mt19937 rng(1);
+    for (int step = 0; step < 20000; step++) {
+        int x = rng() % size, y = rng() % size;
+        FieldValue value = (FieldValue)(rng() % 3);
+        reference.setValue(x, y, value);
+        randomBoard.setValue(x, y, value);
+        if (step % 100 != 0) continue;
+        for (int i = 0; i < size; i++) {
+            for (int j = 0; j < size; j++) {
+                assert(randomBoard.isCaptured(i, j) == checker.isCaptured(i, j));
+            }
+        }
+    }
+
+    // Random moves, the reference lifts captured groups with the BFS checker
+    const int dx[4] = {-1, 1, 0, 0}, dy[4] = {0, 0, -1, 1};
+    Board played(size);
+    StoneCaptureChecker playedChecker(&played);
+    IncrementalCaptureBoard playedBoard(size);
+    for (int step = 0; step < 20000; step++) {
+        int x = rng() % size, y = rng() % size;
+        FieldValue color = step % 2 ? WHITE : BLACK;
+        playedBoard.playMove(x, y, color);
+        if (played.getValue(x, y) != EMPTY) continue;
+        played.setValue(x, y, color);
+        vector<pair<int, int>> lifted;
+        for (int i = 0; i < 4; i++) {
+            FieldValue neighbor = played.getValue(x + dx[i], y + dy[i]);
+            if (neighbor == EMPTY || neighbor == color || !playedChecker.isCaptured(x + dx[i], y + dy[i])) continue;
+            for (int a = 0; a < size; a++)
+                for (int b = 0; b < size; b++)
+                    if (played.getValue(a, b) == neighbor && playedChecker.isCaptured(a, b)) lifted.push_back({a, b});
+        }
+        for (auto [a, b] : lifted) played.setValue(a, b, EMPTY);
+        for (int a = 0; a < size; a++)
+            for (int b = 0; b < size; b++) assert(played.getValue(a, b) == playedBoard.getValue(a, b));
+    }
+    cout << "Incremental board matches the BFS checker" << endl << endl;
+
+    benchmarkPlayouts(19, 20000, 1000);
+    benchmarkQueries(19, 90, 2000);
+    benchmarkQueries(1000, 90, 2);
+    return 0;
+}
+
+/*
+=== PROBLEM STATEMENT ===
+
+Same as DetectCapturedStonesInGoGame.cpp, but for self-play: millions of positions per
+second, where StoneCaptureChecker::isCaptured re-runs a BFS with a set<pair<int,int>>
+visited on every query.
+
+=== APPROACH ===
+
+Maintain chains and their liberties incrementally instead of flood-filling per query.
+
+1. Chains: union-find over board cells (union by size, path halving), plus a circular
+   "next stone" list per chain. Merging two rings is one swap of next pointers.
+
+2. Pseudo-liberties on each chain root: sum over the chain's stones of their empty
+   neighbours. A chain is captured <=> pseudo-liberties == 0.
+   - Place a stone: every adjacent stone's chain loses 1, the new stone starts with its
+     own empty neighbours, then it is united with same-colored neighbours (sums add).
+   - Remove a stone: every adjacent opposing chain gains 1. Its own chain may split,
+     so that chain's remaining stones are regrouped from scratch.
+
+3. playMove: place the stone, then remove any adjacent opposing chain whose count
+   dropped to 0. Each captured stone gives +1 to the surviving chains next to it.
+
+Off-board neighbours count as liberties, matching Board::getValue returning EMPTY
+outside the board. The board is stored with a one-cell OFF_BOARD frame, so neighbour
+walks are four fixed offsets with no bounds checks.
+
+=== COMPLEXITY ===
+- isCaptured: O(α(n))
+- setValue placing a stone: O(α(n))
+- setValue removing / recolouring a stone: O(size of its chain)
+- playMove: O(α(n)) + O(captured stones)
+*/
@@ -0,0 +1,363 @@
+#include <bits/stdc++.h>
+
+using namespace std;
+
+// Robot locator for a warehouse whose 'X' blockers and 'O' robots change every tick.
+// The four directional distances of every cell are kept in flat row-major arrays, and
+// robot signatures live in a flat hash table that supports erase. Changing one cell only
+// touches the row segment and column segment between its neighbouring blockers, and
+// re-keys the robots inside those two segments.
+class IncrementalRobotLocator {
+  private:
+    static constexpr uint64_t EMPTY = 0;      // Real signatures are never 0, every distance is >= 1
+    static constexpr uint64_t ERASED = ~0ULL; // Tombstone, would need a 65535-wide gap on every side
+
+    struct Slot {
+        uint64_t key;
+        uint32_t cell; // row * cols + col of the robot, < 2^32 for 16-bit sides
+    };
+
+    int rows, cols;
+    vector<char> grid; // row-major
+    vector<uint16_t> left, right, top, bottom;
+
+    // Signature -> robot cells, linear probing. Several robots may share a signature.
+    vector<Slot> slots;
+    size_t mask = 0, live = 0, used = 0; // used = live + tombstones
+    int shift = 64;
+
+    static uint64_t pack(int left, int top, int bottom, int right) {
+        return (uint64_t)left | (uint64_t)top << 16 | (uint64_t)bottom << 32 | (uint64_t)right << 48;
+    }
+
+    uint64_t signatureOf(size_t cell) const {
+        return pack(this->left[cell], this->top[cell], this->bottom[cell], this->right[cell]);
+    }
+
+    size_t slotOf(uint64_t key) const {
+        return (key * 0x9E3779B97F4A7C15ULL) >> this->shift;
+    }
+
+    void resizeTable(size_t robots) {
+        size_t capacity = 16;
+        while(capacity < 4 * robots) capacity <<= 1;
+        vector<Slot> old = move(this->slots);
+        this->slots.assign(capacity, {EMPTY, 0});
+        this->mask = capacity - 1;
+        this->shift = 64 - __builtin_ctzll(capacity);
+        this->live = this->used = 0;
+        for(const Slot& slot : old) {
+            if(slot.key != EMPTY && slot.key != ERASED) insertRobot(slot.key, slot.cell);
+        }
+    }
+
+    void insertRobot(uint64_t key, uint32_t cell) {
+        // Keep live + tombstones under half the table so misses stay short
+        if(2 * (this->used + 1) > this->slots.size()) resizeTable(this->live + 1);
+        size_t slot = slotOf(key);
+        while(this->slots[slot].key != EMPTY && this->slots[slot].key != ERASED) {
+            slot = (slot + 1) & this->mask;
+        }
+        if(this->slots[slot].key == EMPTY) this->used++;
+        this->slots[slot] = {key, cell};
+        this->live++;
+    }
+
+    void eraseRobot(uint64_t key, uint32_t cell) {
+        for(size_t slot = slotOf(key); this->slots[slot].key != EMPTY; slot = (slot + 1) & this->mask) {
+            if(this->slots[slot].key == key && this->slots[slot].cell == cell) {
+                this->slots[slot].key = ERASED;
+                this->live--;
+                return;
+            }
+        }
+    }
+
+    void fullScan() {
+        for(int i = 0; i < this->rows; i++) {
+            size_t base = (size_t)i * this->cols;
+            uint16_t dist = 0;
+            for(int j = 0; j < this->cols; j++) {
+                dist = this->grid[base + j] == 'X' ? 0 : dist + 1;
+                this->left[base + j] = dist;
+            }
+            dist = 0;
+            for(int j = this->cols - 1; j >= 0; j--) {
+                dist = this->grid[base + j] == 'X' ? 0 : dist + 1;
+                this->right[base + j] = dist;
+            }
+        }
+        for(int i = 0; i < this->rows; i++) {
+            size_t base = (size_t)i * this->cols;
+            for(int j = 0; j < this->cols; j++) {
+                uint16_t above = i == 0 ? 0 : this->top[base - this->cols + j];
+                this->top[base + j] = this->grid[base + j] == 'X' ? 0 : above + 1;
+            }
+        }
+        for(int i = this->rows - 1; i >= 0; i--) {
+            size_t base = (size_t)i * this->cols;
+            for(int j = 0; j < this->cols; j++) {
+                uint16_t below = i == this->rows - 1 ? 0 : this->bottom[base + this->cols + j];
+                this->bottom[base + j] = this->grid[base + j] == 'X' ? 0 : below + 1;
+            }
+        }
+    }
+
+    // Rescans the cells strictly between two blockers (or -1 / the grid edge) of one
+    // row or column. cell(k) maps a position along the line to a grid cell; near and
+    // far are the distances towards the lower and higher end of the line.
+    // Robots inside are erased under their old signature and re-inserted after.
+    template <typename CellOf>
+    void refreshSegment(int fromBlocker, int toBlocker, CellOf cell, vector<uint16_t>& near, vector<uint16_t>& far) {
+        for(int k = fromBlocker + 1; k < toBlocker; k++) {
+            if(this->grid[cell(k)] == 'O') eraseRobot(signatureOf(cell(k)), cell(k));
+        }
+        uint16_t dist = 0;
+        for(int k = fromBlocker + 1; k < toBlocker; k++) {
+            dist = this->grid[cell(k)] == 'X' ? 0 : dist + 1;
+            near[cell(k)] = dist;
+        }
+        dist = 0;
+        for(int k = toBlocker - 1; k > fromBlocker; k--) {
+            dist = this->grid[cell(k)] == 'X' ? 0 : dist + 1;
+            far[cell(k)] = dist;
+        }
+        for(int k = fromBlocker + 1; k < toBlocker; k++) {
+            if(this->grid[cell(k)] == 'O') insertRobot(signatureOf(cell(k)), cell(k));
+        }
+    }
+
+  public:
+    IncrementalRobotLocator(const vector<vector<char>>& layout) {
+        this->rows = layout.size();
+        this->cols = this->rows == 0 ? 0 : layout[0].size();
+        if(this->rows > 0xFFFF || this->cols > 0xFFFF) {
+            throw invalid_argument("Grid side must fit in 16 bits");
+        }
+        this->grid.resize((size_t)this->rows * this->cols);
+        for(int i = 0; i < this->rows; i++) {
+            copy(layout[i].begin(), layout[i].end(), this->grid.begin() + (size_t)i * this->cols);
+        }
+        rebuild();
+    }
+
+    // Full O(rows * cols) recompute, the baseline an update is measured against
+    void rebuild() {
+        size_t cells = this->grid.size();
+        this->left.assign(cells, 0);
+        this->right.assign(cells, 0);
+        this->top.assign(cells, 0);
+        this->bottom.assign(cells, 0);
+        fullScan();
+        size_t robots = count(this->grid.begin(), this->grid.end(), 'O');
+        this->slots.clear();
+        resizeTable(robots);
+        for(size_t cell = 0; cell < cells; cell++) {
+            if(this->grid[cell] == 'O') insertRobot(signatureOf(cell), cell);
+        }
+    }
+
+    char cellAt(int i, int j) const {
+        return this->grid[(size_t)i * this->cols + j];
+    }
+
+    // Sets (i, j) to 'X', 'O' or 'E'. Cost is the length of the row and column
+    // segments around (i, j) plus the robots in them, not rows * cols.
+    void setCell(int i, int j, char value) {
+        size_t cell = (size_t)i * this->cols + j;
+        char old = this->grid[cell];
+        if(old == value) return;
+
+        if(old == 'O') eraseRobot(signatureOf(cell), cell);
+        // A new robot is indexed once at the end, not by the segment rescans
+        this->grid[cell] = value == 'O' ? 'E' : value;
+
+        // 'E' <-> 'O' does not move any blocker, so no distance changes
+        if((old == 'X') != (value == 'X')) {
+            // Nearest blockers on either side, read off the neighbours' distances,
+            // which do not depend on (i, j) itself
+            int leftBlocker = j == 0 ? -1 : j - 1 - this->left[cell - 1];
+            int rightBlocker = j == this->cols - 1 ? this->cols : j + 1 + this->right[cell + 1];
+            int upBlocker = i == 0 ? -1 : i - 1 - this->top[cell - this->cols];
+            int downBlocker = i == this->rows - 1 ? this->rows : i + 1 + this->bottom[cell + this->cols];
+            size_t rowBase = (size_t)i * this->cols;
+            int width = this->cols;
+            refreshSegment(leftBlocker, rightBlocker, [&](int k) { return rowBase + k; }, this->left, this->right);
+            refreshSegment(upBlocker, downBlocker, [&](int k) { return (size_t)k * width + j; }, this->top, this->bottom);
+        }
+
+        this->grid[cell] = value;
+        if(value == 'O') insertRobot(signatureOf(cell), cell);
+    }
+
+    void moveRobot(int fromRow, int fromCol, int toRow, int toCol) {
+        setCell(fromRow, fromCol, 'E');
+        setCell(toRow, toCol, 'O');
+    }
+
+    // Query in findRobot order: [left, top, bottom, right]. If several robots share
+    // the signature, any one of them is returned.
+    pair<int, int> locate(int left, int top, int bottom, int right) const {
+        for(int d : {left, top, bottom, right}) {
+            if(d < 1 || d > 0xFFFF) return {-1, -1};
+        }
+        uint64_t key = pack(left, top, bottom, right);
+        for(size_t slot = slotOf(key); this->slots[slot].key != EMPTY; slot = (slot + 1) & this->mask) {
+            if(this->slots[slot].key == key) {
+                return {this->slots[slot].cell / this->cols, this->slots[slot].cell % this->cols};
+            }
+        }
+        return {-1, -1};
+    }
+
+    vector<int> locate(const vector<int>& query) const {
+        if(query.size() != 4) return {-1, -1};
+        auto [row, col] = locate(query[0], query[1], query[2], query[3]);
+        return {row, col};
+    }
+
+    array<int, 4> signature(int i, int j) const {
+        size_t cell = (size_t)i * this->cols + j;
+        return {this->left[cell], this->top[cell], this->bottom[cell], this->right[cell]};
+    }
+
+    int robotCount() const {
+        return this->live;
+    }
+};
+
+// Distances straight from the grid, as the reference for the randomized check
+array<int, 4> walkSignature(const IncrementalRobotLocator& locator, int rows, int cols, int i, int j) {
+    int l = 1, t = 1, b = 1, r = 1;
+    while(j - l >= 0 && locator.cellAt(i, j - l) != 'X') l++;
+    while(i - t >= 0 && locator.cellAt(i - t, j) != 'X') t++;
+    while(i + b < rows && locator.cellAt(i + b, j) != 'X') b++;
+    while(j + r < cols && locator.cellAt(i, j + r) != 'X') r++;
+    return {l, t, b, r};
+}
+
+vector<vector<char>> randomGrid(int rows, int cols, int blockerPercent, int robotPercent, int seed) {
+    mt19937 rng(seed);
+    vector<vector<char>> grid(rows, vector<char>(cols));
+    for(auto& row : grid) {
+        for(char& cell : row) {
+            int roll = rng() % 100;
+            cell = roll < blockerPercent ? 'X' : roll < blockerPercent + robotPercent ? 'O' : 'E';
+        }
+    }
+    return grid;
+}
+
+// One tick = one random blocker toggle plus one robot step to a free neighbour
+void benchmark(int side, int ticks) {
+    IncrementalRobotLocator locator(randomGrid(side, side, 10, 1, 99));
+    mt19937 rng(7);
+
+    auto start = chrono::steady_clock::now();
+    locator.rebuild();
+    double rebuildMs = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+
+    vector<double> latencies;
+    latencies.reserve(2 * ticks);
+    const int dx[4] = {0, 0, 1, -1}, dy[4] = {1, -1, 0, 0};
+    for(int t = 0; t < ticks; t++) {
+        int i = rng() % side, j = rng() % side;
+        char cell = locator.cellAt(i, j);
+        if(cell != 'O') {
+            auto begin = chrono::steady_clock::now();
+            locator.setCell(i, j, cell == 'X' ? 'E' : 'X');
+            latencies.push_back(chrono::duration<double, micro>(chrono::steady_clock::now() - begin).count());
+        }
+        int ri = rng() % side, rj = rng() % side, d = rng() % 4;
+        int ni = ri + dx[d], nj = rj + dy[d];
+        if(locator.cellAt(ri, rj) == 'O' && ni >= 0 && ni < side && nj >= 0 && nj < side && locator.cellAt(ni, nj) == 'E') {
+            auto begin = chrono::steady_clock::now();
+            locator.moveRobot(ri, rj, ni, nj);
+            latencies.push_back(chrono::duration<double, micro>(chrono::steady_clock::now() - begin).count());
+        }
+    }
+    sort(latencies.begin(), latencies.end());
+    double mean = accumulate(latencies.begin(), latencies.end(), 0.0) / latencies.size();
+
+    cout << "Grid " << side << "x" << side << ", robots: " << locator.robotCount() << ", updates: " << latencies.size() << endl;
+    cout << "  Full rebuild:       " << rebuildMs * 1000 << " us" << endl;
+    cout << "  Incremental update: mean " << mean << " us, p50 " << latencies[latencies.size() / 2]
+         << " us, p99 " << latencies[latencies.size() * 99 / 100] << " us" << endl;
+}
+
+int main() {
+    // Test with the given example
+    vector<vector<char>> grid = {
+        {'O','E','E','E','X'},
+        {'E','O','X','X','X'},
+        {'E','E','E','E','E'},
+        {'X','E','O','E','E'},
+        {'X','E','X','E','X'}
+    };
+    IncrementalRobotLocator locator(grid);
+    vector<int> result = locator.locate({2, 2, 4, 1});
+    cout << "Robot found at position: [" << result[0] << ", " << result[1] << "]" << endl;
+
+    // Removing the blocker at (1, 2) opens row 1 and column 2 for the robot at (1, 1)
+    locator.setCell(1, 2, 'E');
+    result = locator.locate({2, 2, 4, 2});
+    cout << "After clearing (1, 2): [" << result[0] << ", " << result[1] << "]" << endl;
+    locator.moveRobot(1, 1, 2, 1);
+    result = locator.locate({2, 3, 3, 4});
+    cout << "After moving the robot to (2, 1): [" << result[0] << ", " << result[1] << "]" << endl;
+
+    // Random edits on a small grid, checked against walking the grid
+    int rows = 23, cols = 31;
+    IncrementalRobotLocator randomLocator(randomGrid(rows, cols, 20, 10, 5));
+    mt19937 rng(3);
+    for(int step = 0; step < 20000; step++) {
+        randomLocator.setCell(rng() % rows, rng() % cols, "XOEE"[rng() % 4]);
+        if(step % 500 != 0) continue;
+        int robots = 0;
+        for(int i = 0; i < rows; i++) {
+            for(int j = 0; j < cols; j++) {
+                if(randomLocator.cellAt(i, j) == 'X') continue;
+                array<int, 4> expected = walkSignature(randomLocator, rows, cols, i, j);
+                assert(randomLocator.signature(i, j) == expected);
+                if(randomLocator.cellAt(i, j) != 'O') continue;
+                robots++;
+                auto [fr, fc] = randomLocator.locate(expected[0], expected[1], expected[2], expected[3]);
+                assert(fr >= 0 && walkSignature(randomLocator, rows, cols, fr, fc) == expected);
+            }
+        }
+        assert(robots == randomLocator.robotCount());
+    }
+    cout << "Incremental updates match a full rescan" << endl;
+
+    benchmark(4000, 200000);
+    benchmark(10000, 200000);
+    return 0;
+}
+
+/*
+PROBLEM STATEMENT:
+Same as FindTheLocationOfTheRobot.cpp, but 'X' blockers and 'O' robots change every
+tick. Rebuilding the distance matrices and the signature map costs O(rows * cols)
+per change (strategy 3b, incremental update, in FindTheLocationOfTheRobot.cpp).
+
+APPROACH:
+- Keep left / right / top / bottom distances for every cell in flat arrays and the
+  robot signatures in a flat linear-probing table with tombstones, so robots can be
+  re-keyed. Several robots may share a signature.
+- 'E' <-> 'O': no blocker moves, so no distance changes; only erase / insert the
+  robot's signature.
+- A blocker appears or disappears at (i, j):
+  * Only row i between the nearest blockers left and right of j changes its
+    left/right distances, and only column j between the nearest blockers above and
+    below changes its top/bottom distances.
+  * Those nearest blockers come from the neighbours' own distances in O(1):
+    leftBlocker = j - 1 - left[i][j - 1], rightBlocker = j + 1 + right[i][j + 1], ...
+  * Both segments are rescanned forwards and backwards (a new blocker splits
+    them), and every robot inside them is erased under its old signature and
+    inserted under the new one.
+
+TIME COMPLEXITY:
+- setCell: O(row segment + column segment) expected, bounded by O(rows + cols)
+- locate: O(1) expected
+- rebuild: O(rows * cols)
+*/
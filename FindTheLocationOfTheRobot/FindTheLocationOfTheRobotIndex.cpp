@@ -0,0 +1,314 @@
+#include <bits/stdc++.h>
+
+using namespace std;
+
+// Same as findRobot in FindTheLocationOfTheRobot.cpp, kept here as the benchmark baseline
+vector<int> findRobot(vector<vector<char>>& grid, vector<int>& query) {
+    int rows = grid.size();
+    int cols = grid[0].size();
+    vector<vector<int>> leftDist(rows, vector<int>(cols, 0));
+    vector<vector<int>> rightDist(rows, vector<int>(cols, 0));
+    vector<vector<int>> topDist(rows, vector<int>(cols, 0));
+    vector<vector<int>> bottomDist(rows, vector<int>(cols, 0));
+    for(int i = 0; i < rows; i++) {
+        int dist = 0;
+        for(int j = 0; j < cols; j++) {
+            dist = grid[i][j] == 'X' ? 0 : dist + 1;
+            leftDist[i][j] = dist;
+        }
+        dist = 0;
+        for(int j = cols - 1; j >= 0; j--) {
+            dist = grid[i][j] == 'X' ? 0 : dist + 1;
+            rightDist[i][j] = dist;
+        }
+    }
+    for(int j = 0; j < cols; j++) {
+        int dist = 0;
+        for(int i = 0; i < rows; i++) {
+            dist = grid[i][j] == 'X' ? 0 : dist + 1;
+            topDist[i][j] = dist;
+        }
+        dist = 0;
+        for(int i = rows - 1; i >= 0; i--) {
+            dist = grid[i][j] == 'X' ? 0 : dist + 1;
+            bottomDist[i][j] = dist;
+        }
+    }
+    map<vector<int>, vector<int>> robotMap;
+    for(int i = 0; i < rows; i++) {
+        for(int j = 0; j < cols; j++) {
+            if(grid[i][j] == 'O') {
+                robotMap[{leftDist[i][j], topDist[i][j], bottomDist[i][j], rightDist[i][j]}] = {i, j};
+            }
+        }
+    }
+    if(robotMap.find(query) != robotMap.end()) {
+        return robotMap[query];
+    }
+    return {-1, -1};
+}
+
+// Built once per warehouse grid, then answers any number of queries.
+// Each robot's [left, top, bottom, right] distances are packed into one 64-bit key
+// (16 bits per direction) and stored in a flat open-addressing table, so a query is
+// one multiply-shift hash and usually one cache line.
+class RobotLocator {
+  private:
+    static constexpr uint64_t EMPTY = 0; // Real signatures are never 0, every distance is >= 1
+
+    // Key and position share a 16-byte slot, so a hit costs one cache line
+    struct Slot {
+        uint64_t key;
+        int row, col;
+    };
+    vector<Slot> slots; // power-of-two sized, linear probing
+    uint64_t mask = 0;
+    int shift = 64;
+    int robots = 0;
+
+    static bool fits(int distance) {
+        return distance >= 0 && distance <= 0xFFFF;
+    }
+
+    static uint64_t pack(int left, int top, int bottom, int right) {
+        return (uint64_t)left | (uint64_t)top << 16 | (uint64_t)bottom << 32 | (uint64_t)right << 48;
+    }
+
+    size_t slotOf(uint64_t key) const {
+        return (key * 0x9E3779B97F4A7C15ULL) >> this->shift;
+    }
+
+    void insert(uint64_t key, pair<int, int> position) {
+        size_t slot = slotOf(key);
+        while(this->slots[slot].key != EMPTY && this->slots[slot].key != key) {
+            slot = (slot + 1) & this->mask;
+        }
+        // Same signature twice: the later robot wins, as in findRobot
+        this->slots[slot] = {key, position.first, position.second};
+    }
+
+    pair<int, int> lookup(uint64_t key) const {
+        if(this->slots.empty()) return {-1, -1};
+        for(size_t slot = slotOf(key); this->slots[slot].key != EMPTY; slot = (slot + 1) & this->mask) {
+            if(this->slots[slot].key == key) return {this->slots[slot].row, this->slots[slot].col};
+        }
+        return {-1, -1};
+    }
+
+  public:
+    RobotLocator(const vector<vector<char>>& grid) {
+        int rows = grid.size();
+        int cols = rows == 0 ? 0 : grid[0].size();
+        if(rows > 0xFFFF || cols > 0xFFFF) {
+            throw invalid_argument("Grid side must fit in 16 bits");
+        }
+
+        // Flat row-major scans: left/right per row, then top/bottom row by row so the
+        // vertical scans also walk memory sequentially
+        vector<uint16_t> left((size_t)rows * cols), right((size_t)rows * cols);
+        vector<uint16_t> top((size_t)rows * cols), bottom((size_t)rows * cols);
+        for(int i = 0; i < rows; i++) {
+            uint16_t dist = 0;
+            for(int j = 0; j < cols; j++) {
+                dist = grid[i][j] == 'X' ? 0 : dist + 1;
+                left[(size_t)i * cols + j] = dist;
+            }
+            dist = 0;
+            for(int j = cols - 1; j >= 0; j--) {
+                dist = grid[i][j] == 'X' ? 0 : dist + 1;
+                right[(size_t)i * cols + j] = dist;
+            }
+        }
+        for(int i = 0; i < rows; i++) {
+            for(int j = 0; j < cols; j++) {
+                uint16_t above = i == 0 ? 0 : top[(size_t)(i - 1) * cols + j];
+                top[(size_t)i * cols + j] = grid[i][j] == 'X' ? 0 : above + 1;
+            }
+        }
+        for(int i = rows - 1; i >= 0; i--) {
+            for(int j = 0; j < cols; j++) {
+                uint16_t below = i == rows - 1 ? 0 : bottom[(size_t)(i + 1) * cols + j];
+                bottom[(size_t)i * cols + j] = grid[i][j] == 'X' ? 0 : below + 1;
+            }
+        }
+
+        for(int i = 0; i < rows; i++) {
+            for(int j = 0; j < cols; j++) robots += grid[i][j] == 'O';
+        }
+        // Load factor <= 0.5 keeps probe sequences short
+        size_t capacity = 1;
+        while(capacity < 2 * (size_t)max(robots, 1)) capacity <<= 1;
+        this->slots.assign(capacity, {EMPTY, -1, -1});
+        this->mask = capacity - 1;
+        this->shift = 64 - __builtin_ctzll(capacity);
+        if(capacity == 1) this->shift = 63; // Shifting by 64 is undefined, slot is 0 either way
+
+        for(int i = 0; i < rows; i++) {
+            for(int j = 0; j < cols; j++) {
+                if(grid[i][j] != 'O') continue;
+                size_t at = (size_t)i * cols + j;
+                insert(pack(left[at], top[at], bottom[at], right[at]), {i, j});
+            }
+        }
+    }
+
+    int robotCount() const {
+        return this->robots;
+    }
+
+    // Query in findRobot order: [left, top, bottom, right]
+    pair<int, int> locate(int left, int top, int bottom, int right) const {
+        if(!fits(left) || !fits(top) || !fits(bottom) || !fits(right)) return {-1, -1};
+        return lookup(pack(left, top, bottom, right));
+    }
+
+    vector<int> locate(const vector<int>& query) const {
+        if(query.size() != 4) return {-1, -1};
+        auto [row, col] = locate(query[0], query[1], query[2], query[3]);
+        return {row, col};
+    }
+
+    // Batched lookups: hash a block of queries and prefetch their home slots before
+    // probing any of them, so the table misses of a block overlap
+    void locateBatch(const vector<array<int, 4>>& queries, vector<pair<int, int>>& result) const {
+        constexpr size_t Block = 16;
+        result.resize(queries.size());
+        uint64_t blockKeys[Block];
+        bool valid[Block];
+        for(size_t base = 0; base < queries.size(); base += Block) {
+            size_t n = min(Block, queries.size() - base);
+            for(size_t k = 0; k < n; k++) {
+                const array<int, 4>& q = queries[base + k];
+                valid[k] = fits(q[0]) && fits(q[1]) && fits(q[2]) && fits(q[3]) && !this->slots.empty();
+                blockKeys[k] = pack(q[0] & 0xFFFF, q[1] & 0xFFFF, q[2] & 0xFFFF, q[3] & 0xFFFF);
+                if(valid[k]) __builtin_prefetch(&this->slots[slotOf(blockKeys[k])]);
+            }
+            for(size_t k = 0; k < n; k++) {
+                result[base + k] = valid[k] ? lookup(blockKeys[k]) : make_pair(-1, -1);
+            }
+        }
+    }
+};
+
+// rows x cols warehouse with the given percentages of blockers and robots.
+// Queries are signatures of random robots plus 10% random misses.
+void benchmark(int rows, int cols, int blockerPercent, int robotPercent, int queries) {
+    mt19937 rng(42);
+    vector<vector<char>> grid(rows, vector<char>(cols));
+    for(auto& row : grid) {
+        for(char& cell : row) {
+            int roll = rng() % 100;
+            cell = roll < blockerPercent ? 'X' : roll < blockerPercent + robotPercent ? 'O' : 'E';
+        }
+    }
+
+    auto start = chrono::steady_clock::now();
+    RobotLocator locator(grid);
+    double buildMs = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+
+    // Collect real signatures with findRobot's own scans for the query mix
+    vector<array<int, 4>> signatures;
+    for(int i = 0; i < rows && (int)signatures.size() < 100000; i++) {
+        for(int j = 0; j < cols && (int)signatures.size() < 100000; j++) {
+            if(grid[i][j] != 'O') continue;
+            int l = 1, t = 1, b = 1, r = 1;
+            while(j - l >= 0 && grid[i][j - l] != 'X') l++;
+            while(i - t >= 0 && grid[i - t][j] != 'X') t++;
+            while(i + b < rows && grid[i + b][j] != 'X') b++;
+            while(j + r < cols && grid[i][j + r] != 'X') r++;
+            signatures.push_back({l, t, b, r});
+        }
+    }
+    vector<array<int, 4>> batch(queries);
+    for(auto& q : batch) {
+        if(rng() % 10 == 0) {
+            q = {(int)(rng() % 1000) + 1, (int)(rng() % 1000) + 1, (int)(rng() % 1000) + 1, (int)(rng() % 1000) + 1};
+        } else {
+            q = signatures[rng() % signatures.size()];
+        }
+    }
+
+    start = chrono::steady_clock::now();
+    long long singleFound = 0;
+    for(auto& q : batch) singleFound += locator.locate(q[0], q[1], q[2], q[3]).first >= 0;
+    double singleMs = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+
+    vector<pair<int, int>> result;
+    start = chrono::steady_clock::now();
+    locator.locateBatch(batch, result);
+    double batchMs = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+    long long batchFound = 0;
+    for(auto& position : result) batchFound += position.first >= 0;
+
+    int baselineCalls = 1;
+    start = chrono::steady_clock::now();
+    long long baselineFound = 0;
+    for(int k = 0; k < baselineCalls; k++) {
+        vector<int> query(batch[k].begin(), batch[k].end());
+        baselineFound += findRobot(grid, query)[0] >= 0;
+    }
+    double baselineMs = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count() / baselineCalls;
+
+    cout << "Grid " << rows << "x" << cols << ", robots: " << locator.robotCount() << ", queries: " << queries << endl;
+    cout << "  findRobot:           " << baselineMs << " ms per query" << endl;
+    cout << "  RobotLocator build:  " << buildMs << " ms" << endl;
+    cout << "  RobotLocator single: " << singleMs * 1e6 / queries << " ns per query (found " << singleFound << ")" << endl;
+    cout << "  RobotLocator batch:  " << batchMs * 1e6 / queries << " ns per query (found " << batchFound << ")" << endl;
+}
+
+int main() {
+    // Test with the given example
+    vector<vector<char>> grid = {
+        {'O','E','E','E','X'},
+        {'E','O','X','X','X'},
+        {'E','E','E','E','E'},
+        {'X','E','O','E','E'},
+        {'X','E','X','E','X'}
+    };
+
+    RobotLocator locator(grid);
+    vector<int> query = {2, 2, 4, 1};
+    vector<int> result = locator.locate(query);
+
+    if(result[0] != -1) {
+        cout << "Robot found at position: [" << result[0] << ", " << result[1] << "]" << endl;
+    } else {
+        cout << "Robot not found!" << endl;
+    }
+
+    vector<array<int, 4>> queries = {{2, 2, 4, 1}, {1, 1, 3, 4}, {2, 2, 1, 3}, {1, 1, 1, 1}};
+    vector<pair<int, int>> positions;
+    locator.locateBatch(queries, positions);
+    for(size_t k = 0; k < queries.size(); k++) {
+        vector<int> q(queries[k].begin(), queries[k].end());
+        vector<int> expected = findRobot(grid, q);
+        assert(positions[k] == make_pair(expected[0], expected[1]));
+        cout << "[" << q[0] << ", " << q[1] << ", " << q[2] << ", " << q[3] << "] -> ["
+             << positions[k].first << ", " << positions[k].second << "]" << endl;
+    }
+
+    benchmark(4000, 4000, 20, 1, 10000000);
+    benchmark(10000, 10000, 20, 2, 10000000);
+    return 0;
+}
+
+/*
+PROBLEM STATEMENT:
+Same as FindTheLocationOfTheRobot.cpp, but the same warehouse grid is queried millions
+of times per shift. findRobot redoes the O(rows * cols) scans, allocates four
+vector<vector<int>> matrices and builds a map<vector<int>, vector<int>> on every call.
+
+APPROACH (STATIC MAP + MANY QUERIES, strategy 1 in FindTheLocationOfTheRobot.cpp):
+- RobotLocator runs the four directional scans once over flat uint16_t arrays.
+- A signature [left, top, bottom, right] packs into one uint64_t, 16 bits per side.
+  Every distance counts the robot's own cell, so no real signature is 0, and 0
+  marks an empty slot.
+- Signatures go into a flat linear-probing table (load factor <= 0.5) whose
+  16-byte slots hold the key and the position. No per-entry heap allocations.
+- locateBatch hashes a block of 16 queries and prefetches their home slots before
+  probing, so cache misses of independent queries overlap.
+
+TIME COMPLEXITY:
+- Build: O(rows * cols) once
+- Query: O(1) expected
+*/
@@ -1,6 +1,13 @@
 #include <iostream>
 #include <vector>
 #include <algorithm>
+#include <string>
+#include <fstream>
+#include <sstream>
+#include <random>
+#include <thread>
+#include <stdexcept>
+#include "../PrefixSum.h"
 using namespace std;
 
 /*
@@ -164,41 +171,98 @@ instead of manually flipping each light switch between 2 and 4.
 KEY INSIGHT: 
 Range updates become O(1) instead of O(range_size), making the entire 
 algorithm O(N) instead of O(N²).
+
+IMPLEMENTATION:
+The scatter and the prefix sum run on the shared kernel in PrefixSum.h: each
+thread marks its share of people in its own difference array, the arrays are
+merged, and the prefix sum is a blocked two-pass scan with SSE2 inside each block.
+With threads = 1 it is the plain diff[start]++ / diff[end+1]-- pass on one array.
 */
-int solveLinear(int n, vector<pair<int, int>>& constraints) {
-    vector<int> diff(n + 2, 0);  // Extra space to avoid boundary checks
-    
-    // Mark range boundaries using difference array
-    for (int i = 0; i < n; i++) {
-        int L = constraints[i].first;
-        int H = constraints[i].second;
-        
-        int start = L + 1;  // Willing from group size (L+1)
-        int end = H + 1;    // Willing until group size (H+1)
-        
-        if (start <= n) {
-            diff[start]++;
+int solveLinear(int n, vector<pair<int, int>>& constraints, unsigned threads = 1) {
+    // Group sizes 0..n; the kernel clips each person's range to them
+    prefix_sum::DifferenceArray diff(n + 1, threads);
+    diff.addRanges(constraints.data(), n, [](const pair<int, int>& c) {
+        return make_pair(c.first + 1, c.second + 1);  // Willing for group sizes (L+1) to (H+1)
+    });
+    vector<int> count = diff.counts();
+
+    // Largest feasible group size: scan down from n and stop at the first one
+    for (int k = n; k >= 1; k--) {
+        if (count[k] >= k) {
+            return k;
         }
-        if (end + 1 <= n + 1) {
-            diff[end + 1]--;
+    }
+    return 0;
+}
+
+/*
+STREAMED INPUT:
+Reads constraints ("N" then N lines "L H", as in SAMPLE INPUT below) from any
+istream. The input is read in fixed-size chunks and parsed in place, and people are
+fed to the kernel in batches, so memory stays at the difference arrays plus one
+batch no matter how many people the input holds.
+*/
+int solveLinearFromStream(istream& in, unsigned threads = 1) {
+    vector<char> buffer(1 << 20);
+    size_t length = 0, pos = 0;
+    bool eof = false;
+    // Next non-negative integer in the input, -1 at end of input
+    auto nextInt = [&]() -> long long {
+        long long value = -1;
+        while (true) {
+            if (pos == length) {
+                if (eof) return value;
+                in.read(buffer.data(), buffer.size());
+                length = in.gcount();
+                pos = 0;
+                eof = length < buffer.size();
+                if (length == 0) return value;
+            }
+            char c = buffer[pos];
+            if (c >= '0' && c <= '9') {
+                value = (value < 0 ? 0 : value * 10) + (c - '0');
+            } else if (value >= 0) {
+                return value;
+            }
+            pos++;
         }
+    };
+
+    long long n = nextInt();
+    if (n < 0) {
+        throw runtime_error("Missing people count");
     }
-    
-    // Convert difference array to actual counts using prefix sum
-    vector<int> count(n + 1, 0);
-    for (int k = 1; k <= n; k++) {
-        count[k] = count[k - 1] + diff[k];
+    prefix_sum::DifferenceArray diff(n + 1, threads);
+    vector<pair<int, int>> batch;
+    batch.reserve(1 << 20);
+    for (long long person = 0; person < n; person++) {
+        long long L = nextInt(), H = nextInt();
+        if (H < 0) {
+            throw runtime_error("File ends after " + to_string(person) + " of " + to_string(n) + " people");
+        }
+        batch.push_back({(int)min<long long>(L + 1, n + 1), (int)min<long long>(H + 1, n + 1)});
+        if (batch.size() == batch.capacity()) {
+            diff.addRanges(batch.data(), batch.size());
+            batch.clear();
+        }
     }
-    
-    // Find maximum group size where count[k] >= k
-    int answer = 0;
-    for (int k = 1; k <= n; k++) {
+    diff.addRanges(batch.data(), batch.size());
+    vector<int> count = diff.counts();
+
+    for (long long k = n; k >= 1; k--) {
         if (count[k] >= k) {
-            answer = k;
+            return k;
         }
     }
-    
-    return answer;
+    return 0;
+}
+
+int solveLinearFromFile(const string& path, unsigned threads = 1) {
+    ifstream file(path, ios::binary);
+    if (!file) {
+        throw runtime_error("Cannot open constraint file: " + path);
+    }
+    return solveLinearFromStream(file, threads);
 }
 
 // Helper function to show detailed analysis (optional)
@@ -270,6 +334,32 @@ int main() {
     }
     
     cout << "\n🎉 ANSWER: Maximum group size = " << result1 << "\n";
+
+    // Same sample, streamed as it would be read from a constraint file
+    stringstream sample;
+    sample << n << "\n";
+    for (auto& c : constraints) {
+        sample << c.first << " " << c.second << "\n";
+    }
+    cout << "Streamed input: " << solveLinearFromStream(sample) << "\n";
+
+    // Large random input: the multi-threaded kernel must match the serial pass
+    int bigN = 2000000;
+    unsigned threads = max(2u, thread::hardware_concurrency());
+    mt19937 rng(17);
+    vector<pair<int, int>> people(bigN);
+    stringstream bigInput;
+    bigInput << bigN << "\n";
+    for (auto& person : people) {
+        person.first = rng() % (bigN / 2);
+        person.second = person.first + rng() % (bigN / 2);
+        bigInput << person.first << " " << person.second << "\n";
+    }
+    int serial = solveLinear(bigN, people, 1);
+    int parallel = solveLinear(bigN, people, threads);
+    int streamed = solveLinearFromStream(bigInput, threads);
+    cout << (serial == parallel && parallel == streamed ? "✓" : "✗") << " " << bigN << " people: serial "
+         << serial << ", " << threads << " threads " << parallel << ", streamed " << streamed << "\n";
     
     // Optional detailed analysis
     char analysisChoice;
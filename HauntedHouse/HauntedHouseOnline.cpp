@@ -0,0 +1,283 @@
+#include <iostream>
+#include <vector>
+#include <algorithm>
+#include <random>
+#include <chrono>
+#include <cassert>
+using namespace std;
+
+/*
+================================================================================
+ONLINE VERSION:
+Same problem as HauntedHouse.cpp, but the invite list changes one person at a
+time and the answer is needed after every change. solveLinear rebuilds the
+difference array and prefix sums from scratch - O(N) per change.
+
+Keep instead, for every group size k, the value
+    slack[k] = count[k] - k
+in a segment tree. Adding person (L,H) is a range add of +1 on group sizes
+[L+1, H+1]; removing them is a range add of -1. Group size k is feasible exactly
+when slack[k] >= 0, so the answer is the RIGHTMOST k with slack[k] >= 0, found by
+walking down the tree and preferring the right child whenever its maximum is
+still >= 0. Both operations are O(log C) for C possible group sizes.
+
+A Fenwick tree can do the range add too, but it cannot tell which half of a
+range holds a non-negative value, so the descent needs the segment tree's
+per-node maximum.
+================================================================================
+*/
+
+// Same as HauntedHouse.cpp, kept here as the benchmark baseline
+int solveNSquared(int n, vector<pair<int, int>>& constraints) {
+    vector<int> count(n + 1, 0);
+    for (int i = 0; i < n; i++) {
+        int L = constraints[i].first;
+        int H = constraints[i].second;
+        for (int groupSize = L + 1; groupSize <= H + 1 && groupSize <= n; groupSize++) {
+            count[groupSize]++;
+        }
+    }
+    int answer = 0;
+    for (int k = 1; k <= n; k++) {
+        if (count[k] >= k) {
+            answer = k;
+        }
+    }
+    return answer;
+}
+
+// Serial solveLinear from HauntedHouse.cpp, kept here as the benchmark baseline
+int solveLinear(int n, vector<pair<int, int>>& constraints) {
+    vector<int> diff(n + 2, 0);
+    for (int i = 0; i < n; i++) {
+        int L = constraints[i].first;
+        int H = constraints[i].second;
+        int start = L + 1;
+        int end = H + 1;
+        if (start <= n) {
+            diff[start]++;
+        }
+        if (end + 1 <= n + 1) {
+            diff[end + 1]--;
+        }
+    }
+    vector<int> count(n + 1, 0);
+    for (int k = 1; k <= n; k++) {
+        count[k] = count[k - 1] + diff[k];
+    }
+    int answer = 0;
+    for (int k = 1; k <= n; k++) {
+        if (count[k] >= k) {
+            answer = k;
+        }
+    }
+    return answer;
+}
+
+// Online solver: segment tree over group sizes 1..capacity holding count[k] - k
+/*
+Each node stores the maximum slack of its range and a pending add that applies to
+its whole range. Adds are never pushed down: a node's true maximum is its stored
+maximum plus the adds of all its ancestors, which the descent accumulates on the
+way. Leaves past capacity start at a large negative value so they never qualify.
+
+Group sizes beyond the number of people can never be feasible (count[k] <= people),
+so capacity only has to cover the largest group the tool will ever see.
+*/
+class OnlineGroupSolver {
+    static constexpr int NEVER = -(1 << 29);
+
+    int capacity;
+    int leaves;            // Power of two >= capacity
+    int people = 0;
+    vector<int> maxSlack;  // Maximum of the node's range, excluding ancestors' adds
+    vector<int> pending;   // Add applied to the node's whole range
+
+    void rangeAdd(int node, int nodeLo, int nodeHi, int lo, int hi, int delta) {
+        if (hi < nodeLo || nodeHi < lo) return;
+        if (lo <= nodeLo && nodeHi <= hi) {
+            maxSlack[node] += delta;
+            pending[node] += delta;
+            return;
+        }
+        int mid = (nodeLo + nodeHi) / 2;
+        rangeAdd(2 * node, nodeLo, mid, lo, hi, delta);
+        rangeAdd(2 * node + 1, mid + 1, nodeHi, lo, hi, delta);
+        maxSlack[node] = max(maxSlack[2 * node], maxSlack[2 * node + 1]) + pending[node];
+    }
+
+    void update(int L, int H, int delta) {
+        int lo = L + 1;                 // Willing from group size (L+1)
+        int hi = min(H + 1, capacity);  // Willing until group size (H+1)
+        if (lo <= hi) {
+            rangeAdd(1, 1, leaves, lo, hi, delta);
+        }
+    }
+
+public:
+    explicit OnlineGroupSolver(int capacity) : capacity(capacity), leaves(1) {
+        while (leaves < capacity) leaves *= 2;
+        maxSlack.assign(2 * leaves, NEVER);
+        pending.assign(2 * leaves, 0);
+        // No one invited yet: slack[k] = 0 - k
+        for (int k = 1; k <= capacity; k++) {
+            maxSlack[leaves + k - 1] = -k;
+        }
+        for (int node = leaves - 1; node >= 1; node--) {
+            maxSlack[node] = max(maxSlack[2 * node], maxSlack[2 * node + 1]);
+        }
+    }
+
+    // Person (L,H) joins the invite list - O(log C)
+    void addPerson(int L, int H) {
+        update(L, H, +1);
+        people++;
+    }
+
+    // Person (L,H) leaves the invite list; they must have been added before - O(log C)
+    void removePerson(int L, int H) {
+        assert(people > 0);
+        update(L, H, -1);
+        people--;
+    }
+
+    // Largest k with count[k] >= k, 0 if none - O(log C)
+    int maxGroupSize() const {
+        if (maxSlack[1] < 0) return 0;
+        int node = 1;
+        int above = 0;  // Sum of pending adds of the node's strict ancestors
+        while (node < leaves) {
+            above += pending[node];
+            node = (maxSlack[2 * node + 1] + above >= 0) ? 2 * node + 1 : 2 * node;
+        }
+        return node - leaves + 1;
+    }
+
+    int size() const {
+        return people;
+    }
+};
+
+double elapsedMs(chrono::steady_clock::time_point start) {
+    return chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+}
+
+int main() {
+    cout << "=== HAUNTED HOUSE - ONLINE MAX GROUP WITH DYNAMIC CONSTRAINTS ===\n\n";
+
+    // Sample from HauntedHouse.cpp, invited one person at a time
+    vector<pair<int, int>> sample = {{1, 2}, {1, 4}, {0, 3}, {0, 1}, {3, 4}, {0, 2}};
+    OnlineGroupSolver solver(6);
+    cout << "--- INVITING ---\n";
+    for (size_t i = 0; i < sample.size(); i++) {
+        solver.addPerson(sample[i].first, sample[i].second);
+        cout << "Person " << (i + 1) << " (" << sample[i].first << ", " << sample[i].second
+             << ") joins → max group size " << solver.maxGroupSize() << "\n";
+    }
+    cout << "--- UNINVITING ---\n";
+    for (int i : {2, 0}) {
+        solver.removePerson(sample[i].first, sample[i].second);
+        cout << "Person " << (i + 1) << " leaves → max group size " << solver.maxGroupSize() << "\n";
+    }
+
+    // Random add/remove sequences, checked against both batch solvers after every update
+    mt19937 rng(11);
+    for (int trial = 0; trial < 200; trial++) {
+        int capacity = 1 + rng() % 60;
+        OnlineGroupSolver online(capacity);
+        vector<pair<int, int>> invited;
+        for (int step = 0; step < 200; step++) {
+            if (!invited.empty() && rng() % 3 == 0) {
+                size_t victim = rng() % invited.size();
+                online.removePerson(invited[victim].first, invited[victim].second);
+                invited[victim] = invited.back();
+                invited.pop_back();
+            } else if ((int)invited.size() < capacity) {
+                int L = rng() % (capacity + 2), H = L + rng() % (capacity + 2);
+                online.addPerson(L, H);
+                invited.push_back({L, H});
+            }
+            int n = invited.size();
+            int expected = solveLinear(n, invited);
+            assert(online.maxGroupSize() == expected);
+            assert(solveNSquared(n, invited) == expected);
+        }
+    }
+    cout << "\n✓ Online answers match solveLinear and solveNSquared after every update\n";
+
+    // Benchmark: 10M updates on a list of about 100k people, answer after each update
+    const int capacity = 200000;
+    const int population = 100000;
+    const int updates = 10000000;
+    auto randomPerson = [&]() {
+        int L = rng() % population;
+        int H = L + rng() % (population / 2);
+        return make_pair(L, H);
+    };
+    vector<pair<int, int>> invited;
+    OnlineGroupSolver online(capacity);
+    for (int i = 0; i < population; i++) {
+        invited.push_back(randomPerson());
+        online.addPerson(invited.back().first, invited.back().second);
+    }
+
+    auto start = chrono::steady_clock::now();
+    long long answerSum = 0;
+    for (int step = 0; step < updates; step++) {
+        size_t victim = rng() % invited.size();
+        if (step % 2 == 0) {
+            online.removePerson(invited[victim].first, invited[victim].second);
+            invited[victim] = invited.back();
+            invited.pop_back();
+        } else {
+            invited.push_back(randomPerson());
+            online.addPerson(invited.back().first, invited.back().second);
+        }
+        answerSum += online.maxGroupSize();
+    }
+    double onlineMs = elapsedMs(start);
+    assert(online.maxGroupSize() == solveLinear(invited.size(), invited));
+
+    // The batch solvers redo everything per update, so time a sample of updates
+    const int linearSamples = 200;
+    start = chrono::steady_clock::now();
+    long long linearSum = 0;
+    for (int step = 0; step < linearSamples; step++) {
+        invited[rng() % invited.size()] = randomPerson();
+        linearSum += solveLinear(invited.size(), invited);
+    }
+    double linearPerUpdateMs = elapsedMs(start) / linearSamples;
+
+    const int squaredSamples = 2;
+    start = chrono::steady_clock::now();
+    long long squaredSum = 0;
+    for (int step = 0; step < squaredSamples; step++) {
+        invited[rng() % invited.size()] = randomPerson();
+        squaredSum += solveNSquared(invited.size(), invited);
+    }
+    double squaredPerUpdateMs = elapsedMs(start) / squaredSamples;
+
+    cout << "\n=== PERFORMANCE (" << population << " people, " << updates / 1000000 << "M updates) ===\n";
+    cout << "Online segment tree: " << onlineMs << " ms total, " << onlineMs * 1e6 / updates
+         << " ns/update (answer checksum " << answerSum << ")\n";
+    cout << "solveLinear:         " << linearPerUpdateMs << " ms/update → ~" << linearPerUpdateMs * updates / 1000
+         << " s for 10M (measured on " << linearSamples << ", checksum " << linearSum << ")\n";
+    cout << "solveNSquared:       " << squaredPerUpdateMs << " ms/update → ~" << squaredPerUpdateMs * updates / 3.6e6
+         << " h for 10M (measured on " << squaredSamples << ", checksum " << squaredSum << ")\n";
+
+    return 0;
+}
+
+/*
+================================================================================
+COMPLEXITY COMPARISON (per invite-list change, C = max group size):
+
+solveNSquared: O(N²) - recount every person's range
+solveLinear:   O(N)   - rebuild difference array and prefix sums
+Online:        O(log C) range add + O(log C) descent, O(C) memory
+
+The descent relies on count[k] - k being stored directly: "max k with
+count[k] >= k" is not monotone in k, so a binary search over prefix sums cannot
+find it, but "does this subtree contain any slack >= 0" is one maximum lookup.
+================================================================================
+*/
@@ -0,0 +1,410 @@
+/**
+ * LINEAR QUADTREE: POINTER-FREE, ARENA-ALLOCATED, BUILT BOTTOM-UP IN MORTON ORDER
+ *
+ * Same tree as ImageRepresentationUsingQuadtree.cpp, stored in one flat array of
+ * 8-byte nodes with index-based children, and built without ever creating a node
+ * for a pixel that later merges into a uniform region.
+ */
+
+#include <iostream>
+#include <vector>
+#include <array>
+#include <random>
+#include <chrono>
+#include <cassert>
+#include <cstdint>
+#include <stdexcept>
+using namespace std;
+
+/**
+ * Simple QuadTree Node Structure (same as ImageRepresentationUsingQuadtree.cpp,
+ * kept here as the benchmark baseline; the counter only feeds the report)
+ */
+long long quadTreeNodeAllocations = 0;
+
+struct QuadTreeNode {
+    int value;                    // Pixel value (only used for leaves)
+    bool isLeaf;                  // true = leaf, false = internal node
+    QuadTreeNode* topLeft;        // Pointer to top-left child
+    QuadTreeNode* topRight;       // Pointer to top-right child
+    QuadTreeNode* bottomLeft;     // Pointer to bottom-left child
+    QuadTreeNode* bottomRight;    // Pointer to bottom-right child
+
+    // Constructor for leaf node
+    QuadTreeNode(int val) {
+        value = val;
+        isLeaf = true;
+        topLeft = topRight = bottomLeft = bottomRight = nullptr;
+        quadTreeNodeAllocations++;
+    }
+
+    // Constructor for internal node
+    QuadTreeNode(QuadTreeNode* tl, QuadTreeNode* tr, QuadTreeNode* bl, QuadTreeNode* br) {
+        value = 0;  // Not used for internal nodes
+        isLeaf = false;
+        topLeft = tl;
+        topRight = tr;
+        bottomLeft = bl;
+        bottomRight = br;
+        quadTreeNodeAllocations++;
+    }
+};
+
+/**
+ * Build quadtree for a rectangular region (pointer baseline)
+ */
+QuadTreeNode* buildQuadTree(vector<vector<int>>& img, int x1, int x2, int y1, int y2) {
+    if (x1 == x2 && y1 == y2) {
+        return new QuadTreeNode(img[x1][y1]);
+    }
+    int midX = (x1 + x2) / 2;
+    int midY = (y1 + y2) / 2;
+    QuadTreeNode* tl = buildQuadTree(img, x1, midX, y1, midY);
+    QuadTreeNode* tr = buildQuadTree(img, x1, midX, midY + 1, y2);
+    QuadTreeNode* bl = buildQuadTree(img, midX + 1, x2, y1, midY);
+    QuadTreeNode* br = buildQuadTree(img, midX + 1, x2, midY + 1, y2);
+    if (tl->isLeaf && tr->isLeaf && bl->isLeaf && br->isLeaf &&
+        tl->value == tr->value && tl->value == bl->value && tl->value == br->value) {
+        int commonValue = tl->value;
+        delete tl;
+        delete tr;
+        delete bl;
+        delete br;
+        return new QuadTreeNode(commonValue);
+    }
+    return new QuadTreeNode(tl, tr, bl, br);
+}
+
+QuadTreeNode* makeQuadTree(vector<vector<int>>& img) {
+    if (img.empty() || img[0].empty()) {
+        return nullptr;
+    }
+    return buildQuadTree(img, 0, img.size() - 1, 0, img[0].size() - 1);
+}
+
+void deleteTree(QuadTreeNode* node) {
+    if (!node) return;
+    if (!node->isLeaf) {
+        deleteTree(node->topLeft);
+        deleteTree(node->topRight);
+        deleteTree(node->bottomLeft);
+        deleteTree(node->bottomRight);
+    }
+    delete node;
+}
+
+long long countNodes(QuadTreeNode* node) {
+    if (!node) return 0;
+    if (node->isLeaf) return 1;
+    return 1 + countNodes(node->topLeft) + countNodes(node->topRight) +
+           countNodes(node->bottomLeft) + countNodes(node->bottomRight);
+}
+
+/**
+ * One node of the linear quadtree. firstChild == 0 marks a leaf holding `value`;
+ * otherwise the four children sit at firstChild .. firstChild + 3 in the order
+ * topLeft, topRight, bottomLeft, bottomRight. Index 0 is always the root, so it
+ * can never be anyone's child and 0 is free to mean "no children".
+ */
+struct LinearQuadNode {
+    int value;
+    uint32_t firstChild;
+};
+
+/**
+ * Quadtree stored in one vector<LinearQuadNode>: no pointers, no per-node allocation.
+ *
+ * Built bottom-up over the pixels in Morton (Z) order. The Z order visits the four
+ * quadrants of every block one after another, in exactly the topLeft, topRight,
+ * bottomLeft, bottomRight order of the pointer tree, so a block is complete as soon
+ * as its fourth quadrant is. A small stack holds the pending quadrants:
+ * - push each pixel as a uniform level-0 quadrant
+ * - when the top four entries are the same level, they are siblings: four uniform
+ *   entries with one value collapse into one uniform entry a level up; otherwise the
+ *   four are written to the arena and an internal entry pointing at them goes up
+ * A uniform region therefore lives only as a single stack entry until its parent
+ * block turns out to be mixed. The stack never holds more than 3 entries per level.
+ *
+ * Requires a square image with a power-of-two side. Those are the images on which the
+ * pointer version's midpoint split produces four equal quadrants at every level.
+ */
+class LinearQuadTree {
+private:
+    vector<LinearQuadNode> nodes;
+    int side = 0;
+    int levels = 0;
+
+    /**
+     * Even bits of code, packed: the inverse of interleaving
+     */
+    static uint32_t compactBits(uint64_t code) {
+        code &= 0x5555555555555555ULL;
+        code = (code | (code >> 1)) & 0x3333333333333333ULL;
+        code = (code | (code >> 2)) & 0x0F0F0F0F0F0F0F0FULL;
+        code = (code | (code >> 4)) & 0x00FF00FF00FF00FFULL;
+        code = (code | (code >> 8)) & 0x0000FFFF0000FFFFULL;
+        code = (code | (code >> 16)) & 0x00000000FFFFFFFFULL;
+        return (uint32_t)code;
+    }
+
+    void printNode(const LinearQuadNode& node, string prefix) const {
+        if (node.firstChild == 0) {
+            cout << prefix << "LEAF(" << node.value << ")" << endl;
+            return;
+        }
+        const LinearQuadNode* child = &nodes[node.firstChild];
+        cout << prefix << "INTERNAL" << endl;
+        cout << prefix << "├─topLeft: ";
+        printNode(child[0], prefix + "│ ");
+        cout << prefix << "├─topRight: ";
+        printNode(child[1], prefix + "│ ");
+        cout << prefix << "├─bottomLeft: ";
+        printNode(child[2], prefix + "│ ");
+        cout << prefix << "└─bottomRight: ";
+        printNode(child[3], prefix + "  ");
+    }
+
+    bool sameNode(const LinearQuadNode& node, QuadTreeNode* other) const {
+        if (node.firstChild == 0) {
+            return other->isLeaf && other->value == node.value;
+        }
+        const LinearQuadNode* child = &nodes[node.firstChild];
+        return !other->isLeaf && sameNode(child[0], other->topLeft) && sameNode(child[1], other->topRight) &&
+               sameNode(child[2], other->bottomLeft) && sameNode(child[3], other->bottomRight);
+    }
+
+public:
+    static LinearQuadTree build(const vector<vector<int>>& img) {
+        LinearQuadTree tree;
+        if (img.empty() || img[0].empty()) {
+            return tree;
+        }
+        int n = img.size();
+        if (img[0].size() != (size_t)n || (n & (n - 1)) != 0) {
+            throw invalid_argument("LinearQuadTree needs a square image with a power-of-two side");
+        }
+        tree.side = n;
+        while ((1 << tree.levels) < n) tree.levels++;
+
+        struct Pending {
+            LinearQuadNode node;
+            int level;
+        };
+        vector<Pending> stack;
+        stack.reserve(3 * tree.levels + 4);
+        tree.nodes.push_back({0, 0}); // Root slot, filled in at the end
+
+        // Pushes a uniform quadrant and collapses every block it completes
+        auto pushUniform = [&](int value, int level) {
+            stack.push_back({{value, 0}, level});
+            while (stack.size() >= 4 && stack[stack.size() - 4].level == stack.back().level) {
+                Pending* group = &stack[stack.size() - 4];
+                int level = group[0].level;
+                bool uniform = true;
+                for (int i = 0; i < 4; i++) {
+                    uniform = uniform && group[i].node.firstChild == 0 && group[i].node.value == group[0].node.value;
+                }
+                LinearQuadNode parent;
+                if (uniform) {
+                    parent = {group[0].node.value, 0};
+                } else {
+                    parent = {0, (uint32_t)tree.nodes.size()};
+                    for (int i = 0; i < 4; i++) tree.nodes.push_back(group[i].node);
+                }
+                stack.resize(stack.size() - 4);
+                stack.push_back({parent, level + 1});
+            }
+        };
+
+        // Morton code bit pairs are (row bit, col bit), row bit the higher one. The
+        // low bits address a tile of up to 8x8 pixels through a table, so the bit
+        // compaction runs once per tile instead of once per pixel. A uniform tile, the
+        // common case on masks, goes on the stack as one entry.
+        int tileLevels = min(tree.levels, 3), tilePixels = 1 << (2 * tileLevels);
+        vector<pair<int, int>> tileOffset(tilePixels);
+        for (int code = 0; code < tilePixels; code++) {
+            tileOffset[code] = {(int)compactBits(code >> 1), (int)compactBits(code)};
+        }
+        uint64_t tiles = (uint64_t)n * n / tilePixels;
+        for (uint64_t tile = 0; tile < tiles; tile++) {
+            int tileRow = compactBits(tile >> 1) << tileLevels, tileCol = compactBits(tile) << tileLevels;
+            int first = img[tileRow][tileCol];
+            bool uniform = true;
+            for (int dr = 0; dr < (1 << tileLevels); dr++) {
+                const int* row = img[tileRow + dr].data() + tileCol;
+                for (int dc = 0; dc < (1 << tileLevels); dc++) uniform &= row[dc] == first;
+            }
+            if (uniform) {
+                pushUniform(first, tileLevels);
+                continue;
+            }
+            for (auto [dr, dc] : tileOffset) {
+                pushUniform(img[tileRow + dr][tileCol + dc], 0);
+            }
+        }
+        tree.nodes[0] = stack.back().node;
+        tree.nodes.shrink_to_fit();
+        return tree;
+    }
+
+    /**
+     * Walks one child per level, picked by the row and column bits of that level
+     */
+    int valueAt(int row, int col) const {
+        const LinearQuadNode* node = &nodes[0];
+        for (int level = levels - 1; node->firstChild != 0; level--) {
+            int child = ((row >> level) & 1) << 1 | ((col >> level) & 1);
+            node = &nodes[node->firstChild + child];
+        }
+        return node->value;
+    }
+
+    size_t nodeCount() const {
+        return nodes.size();
+    }
+
+    size_t memoryBytes() const {
+        return nodes.capacity() * sizeof(LinearQuadNode);
+    }
+
+    bool sameTree(QuadTreeNode* root) const {
+        if (nodes.empty() || !root) {
+            return nodes.empty() && !root;
+        }
+        return sameNode(nodes[0], root);
+    }
+
+    void print() const {
+        if (nodes.empty()) {
+            cout << "NULL" << endl;
+            return;
+        }
+        printNode(nodes[0], "");
+    }
+};
+
+/**
+ * Satellite-style binary mask: a few random filled disks on an empty background
+ */
+vector<vector<int>> makeMask(int side, int disks, int seed) {
+    mt19937 rng(seed);
+    vector<array<long long, 3>> circles(disks);
+    for (auto& [cx, cy, r] : circles) {
+        cx = rng() % side, cy = rng() % side, r = side / 16 + rng() % (side / 6);
+    }
+    vector<vector<int>> img(side, vector<int>(side, 0));
+    for (int x = 0; x < side; x++) {
+        for (auto& [cx, cy, r] : circles) {
+            long long dx = x - cx;
+            if (dx * dx > r * r) continue;
+            // Span of this disk on row x
+            long long half = 0;
+            while ((half + 1) * (half + 1) + dx * dx <= r * r) half++;
+            for (long long y = max(0LL, cy - half); y <= min((long long)side - 1, cy + half); y++) img[x][y] = 1;
+        }
+    }
+    return img;
+}
+
+double elapsedMs(chrono::steady_clock::time_point start) {
+    return chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+}
+
+void benchmark(int side) {
+    vector<vector<int>> img = makeMask(side, 12, side);
+
+    auto start = chrono::steady_clock::now();
+    LinearQuadTree linear = LinearQuadTree::build(img);
+    double linearMs = elapsedMs(start);
+
+    quadTreeNodeAllocations = 0;
+    start = chrono::steady_clock::now();
+    QuadTreeNode* root = makeQuadTree(img);
+    double pointerMs = elapsedMs(start);
+    long long liveNodes = countNodes(root);
+
+    cout << "\nImage " << side << "x" << side << " (" << (long long)side * side << " pixels)" << endl;
+    cout << "  Linear:  " << linearMs << " ms, " << linear.nodeCount() << " nodes, "
+         << linear.memoryBytes() / 1024.0 << " KB" << endl;
+    cout << "  Pointer: " << pointerMs << " ms, " << liveNodes << " nodes, "
+         << liveNodes * sizeof(QuadTreeNode) / 1024.0 << " KB, " << quadTreeNodeAllocations
+         << " node allocations during the build" << endl;
+    cout << "  Same tree: " << (linear.sameTree(root) ? "yes" : "no") << endl;
+    deleteTree(root);
+}
+
+int main() {
+    cout << "LINEAR QUADTREE DEMO" << endl;
+    cout << "====================" << endl;
+
+    cout << "\n4x4 Image with Mixed Regions" << endl;
+    vector<vector<int>> large = {
+        {1, 1, 2, 2},
+        {1, 1, 2, 2},
+        {3, 4, 5, 5},
+        {6, 7, 5, 5}
+    };
+    LinearQuadTree tree = LinearQuadTree::build(large);
+    cout << "Result: ";
+    tree.print();
+    cout << "Nodes in the arena: " << tree.nodeCount() << endl;
+
+    // Same structure and pixel values as the pointer version on random blocky images
+    for (int side : {1, 2, 8, 64, 256}) {
+        mt19937 rng(side);
+        vector<vector<int>> img(side, vector<int>(side));
+        int block = max(1, side / 8);
+        for (int x = 0; x < side; x++)
+            for (int y = 0; y < side; y++) img[x][y] = (x / block * 7 + y / block * 3 + (rng() % 50 == 0)) % 3;
+        LinearQuadTree linear = LinearQuadTree::build(img);
+        QuadTreeNode* root = makeQuadTree(img);
+        assert(linear.sameTree(root));
+        assert(linear.nodeCount() == (size_t)countNodes(root));
+        for (int x = 0; x < side; x++)
+            for (int y = 0; y < side; y++) assert(linear.valueAt(x, y) == img[x][y]);
+        deleteTree(root);
+    }
+    cout << "Linear quadtree matches the pointer quadtree" << endl;
+
+    benchmark(1024);
+    benchmark(4096);
+    benchmark(16384);
+    return 0;
+}
+
+/*
+================================================================================
+                              PROBLEM DESCRIPTION
+================================================================================
+
+Same quadtree as ImageRepresentationUsingQuadtree.cpp. buildQuadTree creates a
+`new QuadTreeNode` for every pixel and only deletes identical siblings after the
+fact, so a 16k x 16k image costs 268M node allocations even when the result has a
+few thousand nodes, and the final tree is scattered across the heap.
+
+APPROACH (linear quadtree):
+1. Storage: vector<LinearQuadNode>, 8 bytes per node {value, firstChild}.
+   The four children of a node are contiguous, firstChild == 0 means leaf, and
+   index 0 is the root. No pointers, one allocation for the whole tree.
+2. Build bottom-up in Morton order. Pixel code c has row = odd bits of c and
+   col = even bits, so codes 4k..4k+3 are a 2x2 block in TL, TR, BL, BR order,
+   codes 16k..16k+15 a 4x4 block, and so on.
+3. A stack of pending quadrants, at most 3 per level. Each pixel is pushed as a
+   uniform level-0 entry. Whenever the top 4 entries share a level they are one
+   complete block:
+   - all uniform with the same value -> replaced by one uniform entry, level + 1
+   - otherwise -> copied to the arena as 4 contiguous nodes, replaced by an
+     internal entry pointing at them, level + 1
+4. Pixels are read in 8x8 tiles (Morton offsets inside a tile come from a table).
+   A tile whose 64 pixels match is pushed as one level-3 uniform entry.
+5. The last entry left is the root.
+
+Node counts and shapes are identical to the pointer version (checked in main).
+
+TIME COMPLEXITY: O(pixels), no allocation per pixel
+SPACE COMPLEXITY: O(nodes of the final tree) + O(levels) for the stack
+
+LIMITATION: square images with a power-of-two side.
+
+================================================================================
+*/
@@ -0,0 +1,464 @@
+/**
+ * PARALLEL QUADTREE CONSTRUCTION AND REGION QUERIES
+ *
+ * Builds the same QuadTreeNode tree as ImageRepresentationUsingQuadtree.cpp with the
+ * quadrants of the top levels built as separate tasks, and answers queries on a built
+ * tree: pixel value, number of 1s in a rectangle, and union / intersection of masks.
+ */
+
+#include <iostream>
+#include <vector>
+#include <array>
+#include <future>
+#include <random>
+#include <chrono>
+#include <cassert>
+#include <thread>
+using namespace std;
+
+/**
+ * Simple QuadTree Node Structure (same as ImageRepresentationUsingQuadtree.cpp)
+ */
+struct QuadTreeNode {
+    int value;                    // Pixel value (only used for leaves)
+    bool isLeaf;                  // true = leaf, false = internal node
+    QuadTreeNode* topLeft;        // Pointer to top-left child
+    QuadTreeNode* topRight;       // Pointer to top-right child
+    QuadTreeNode* bottomLeft;     // Pointer to bottom-left child
+    QuadTreeNode* bottomRight;    // Pointer to bottom-right child
+
+    // Constructor for leaf node
+    QuadTreeNode(int val) {
+        value = val;
+        isLeaf = true;
+        topLeft = topRight = bottomLeft = bottomRight = nullptr;
+    }
+
+    // Constructor for internal node
+    QuadTreeNode(QuadTreeNode* tl, QuadTreeNode* tr, QuadTreeNode* bl, QuadTreeNode* br) {
+        value = 0;  // Not used for internal nodes
+        isLeaf = false;
+        topLeft = tl;
+        topRight = tr;
+        bottomLeft = bl;
+        bottomRight = br;
+    }
+};
+
+/**
+ * Merges four built quadrants into their parent: one leaf when all four are leaves
+ * with the same value, an internal node otherwise
+ */
+QuadTreeNode* joinQuadrants(QuadTreeNode* tl, QuadTreeNode* tr, QuadTreeNode* bl, QuadTreeNode* br) {
+    if (tl->isLeaf && tr->isLeaf && bl->isLeaf && br->isLeaf &&
+        tl->value == tr->value && tl->value == bl->value && tl->value == br->value) {
+        int commonValue = tl->value;
+        delete tl;
+        delete tr;
+        delete bl;
+        delete br;
+        return new QuadTreeNode(commonValue);
+    }
+    return new QuadTreeNode(tl, tr, bl, br);
+}
+
+/**
+ * Build quadtree for a rectangular region (sequential, as in the original)
+ */
+QuadTreeNode* buildQuadTree(const vector<vector<int>>& img, int x1, int x2, int y1, int y2) {
+    if (x1 == x2 && y1 == y2) {
+        return new QuadTreeNode(img[x1][y1]);
+    }
+    int midX = (x1 + x2) / 2;
+    int midY = (y1 + y2) / 2;
+    QuadTreeNode* tl = buildQuadTree(img, x1, midX, y1, midY);
+    QuadTreeNode* tr = buildQuadTree(img, x1, midX, midY + 1, y2);
+    QuadTreeNode* bl = buildQuadTree(img, midX + 1, x2, y1, midY);
+    QuadTreeNode* br = buildQuadTree(img, midX + 1, x2, midY + 1, y2);
+    return joinQuadrants(tl, tr, bl, br);
+}
+
+/**
+ * Parallel build: for the top `parallelLevels` levels, three quadrants go to their
+ * own tasks and the calling thread builds the fourth, so level k runs 4^k subtrees
+ * at once. Below that every subtree is built sequentially. The quadrants only read
+ * the image and own disjoint subtrees, so the tasks share nothing but the allocator.
+ */
+QuadTreeNode* buildQuadTreeParallel(const vector<vector<int>>& img, int x1, int x2, int y1, int y2, int parallelLevels) {
+    if (parallelLevels == 0 || (x1 == x2 && y1 == y2)) {
+        return buildQuadTree(img, x1, x2, y1, y2);
+    }
+    int midX = (x1 + x2) / 2;
+    int midY = (y1 + y2) / 2;
+    auto task = [&](int a1, int a2, int b1, int b2) {
+        return async(launch::async, buildQuadTreeParallel, cref(img), a1, a2, b1, b2, parallelLevels - 1);
+    };
+    future<QuadTreeNode*> tr = task(x1, midX, midY + 1, y2);
+    future<QuadTreeNode*> bl = task(midX + 1, x2, y1, midY);
+    future<QuadTreeNode*> br = task(midX + 1, x2, midY + 1, y2);
+    QuadTreeNode* tl = buildQuadTreeParallel(img, x1, midX, y1, midY, parallelLevels - 1);
+    return joinQuadrants(tl, tr.get(), bl.get(), br.get());
+}
+
+QuadTreeNode* makeQuadTree(const vector<vector<int>>& img, int parallelLevels = 0) {
+    if (img.empty() || img[0].empty()) {
+        return nullptr;
+    }
+    return buildQuadTreeParallel(img, 0, img.size() - 1, 0, img[0].size() - 1, parallelLevels);
+}
+
+void deleteTree(QuadTreeNode* node) {
+    if (!node) return;
+    if (!node->isLeaf) {
+        deleteTree(node->topLeft);
+        deleteTree(node->topRight);
+        deleteTree(node->bottomLeft);
+        deleteTree(node->bottomRight);
+    }
+    delete node;
+}
+
+bool sameTree(QuadTreeNode* a, QuadTreeNode* b) {
+    if (a->isLeaf || b->isLeaf) {
+        return a->isLeaf && b->isLeaf && a->value == b->value;
+    }
+    return sameTree(a->topLeft, b->topLeft) && sameTree(a->topRight, b->topRight) &&
+           sameTree(a->bottomLeft, b->bottomLeft) && sameTree(a->bottomRight, b->bottomRight);
+}
+
+/**
+ * Read-only index over a built tree for region queries. The tree is flattened into
+ * preorder arrays, with the subtree size and the number of 1 pixels of every node,
+ * so a query never revisits a subtree and a rectangle count adds whole-subtree
+ * counts where the subtree lies entirely inside the rectangle.
+ *
+ * Regions are split exactly like buildQuadTree splits them, so node regions always
+ * match the tree that was built.
+ */
+class QuadTreeRegionIndex {
+private:
+    struct Entry {
+        int value;
+        bool isLeaf;
+        int subtreeSize;   // Nodes in this subtree, including itself
+        long long ones;    // Pixels with value 1 in this node's region
+    };
+
+    vector<Entry> entries;
+    int rows, cols;
+
+    long long flatten(QuadTreeNode* node, int x1, int x2, int y1, int y2) {
+        int index = entries.size();
+        entries.push_back({node->value, node->isLeaf, 1, 0});
+        if (node->isLeaf) {
+            entries[index].ones = node->value == 1 ? (long long)(x2 - x1 + 1) * (y2 - y1 + 1) : 0;
+            return entries[index].ones;
+        }
+        int midX = (x1 + x2) / 2, midY = (y1 + y2) / 2;
+        long long ones = flatten(node->topLeft, x1, midX, y1, midY);
+        ones += flatten(node->topRight, x1, midX, midY + 1, y2);
+        ones += flatten(node->bottomLeft, midX + 1, x2, y1, midY);
+        ones += flatten(node->bottomRight, midX + 1, x2, midY + 1, y2);
+        entries[index].subtreeSize = entries.size() - index;
+        entries[index].ones = ones;
+        return ones;
+    }
+
+    long long countOnes(int index, int x1, int x2, int y1, int y2, int r1, int r2, int c1, int c2) const {
+        if (x2 < r1 || x1 > r2 || y2 < c1 || y1 > c2) {
+            return 0;
+        }
+        const Entry& entry = entries[index];
+        if (r1 <= x1 && x2 <= r2 && c1 <= y1 && y2 <= c2) {
+            return entry.ones;
+        }
+        if (entry.isLeaf) {
+            if (entry.value != 1) return 0;
+            return (long long)(min(x2, r2) - max(x1, r1) + 1) * (min(y2, c2) - max(y1, c1) + 1);
+        }
+        int midX = (x1 + x2) / 2, midY = (y1 + y2) / 2;
+        int tl = index + 1;
+        int tr = tl + entries[tl].subtreeSize;
+        int bl = tr + entries[tr].subtreeSize;
+        int br = bl + entries[bl].subtreeSize;
+        return countOnes(tl, x1, midX, y1, midY, r1, r2, c1, c2) +
+               countOnes(tr, x1, midX, midY + 1, y2, r1, r2, c1, c2) +
+               countOnes(bl, midX + 1, x2, y1, midY, r1, r2, c1, c2) +
+               countOnes(br, midX + 1, x2, midY + 1, y2, r1, r2, c1, c2);
+    }
+
+public:
+    QuadTreeRegionIndex(QuadTreeNode* root, int rows, int cols) : rows(rows), cols(cols) {
+        if (root) {
+            flatten(root, 0, rows - 1, 0, cols - 1);
+        }
+    }
+
+    /**
+     * O(depth): one child per level, skipping earlier siblings by their subtree sizes
+     */
+    int valueAt(int row, int col) const {
+        int index = 0, x1 = 0, x2 = rows - 1, y1 = 0, y2 = cols - 1;
+        while (!entries[index].isLeaf) {
+            int midX = (x1 + x2) / 2, midY = (y1 + y2) / 2;
+            int quadrant = (row > midX ? 2 : 0) + (col > midY ? 1 : 0);
+            index++;
+            for (int skip = 0; skip < quadrant; skip++) index += entries[index].subtreeSize;
+            if (row > midX) x1 = midX + 1; else x2 = midX;
+            if (col > midY) y1 = midY + 1; else y2 = midY;
+        }
+        return entries[index].value;
+    }
+
+    /**
+     * Pixels equal to 1 in rows [r1, r2] x cols [c1, c2]. Visits only the nodes that
+     * straddle the rectangle border, O(perimeter in nodes) rather than O(area).
+     */
+    long long countOnes(int r1, int c1, int r2, int c2) const {
+        if (entries.empty()) return 0;
+        return countOnes(0, 0, rows - 1, 0, cols - 1, r1, r2, c1, c2);
+    }
+};
+
+/**
+ * Deep copy with every value mapped to 0 / 1
+ */
+QuadTreeNode* copyAsMask(QuadTreeNode* node) {
+    if (node->isLeaf) {
+        return new QuadTreeNode(node->value != 0);
+    }
+    return joinQuadrants(copyAsMask(node->topLeft), copyAsMask(node->topRight),
+                         copyAsMask(node->bottomLeft), copyAsMask(node->bottomRight));
+}
+
+/**
+ * Boolean union (intersect = false) or intersection (intersect = true) of two masks
+ * built over the same image size; nonzero values count as 1. A leaf decides its
+ * whole region: for union a 1 leaf wins and a 0 leaf defers to the other tree, and
+ * the other way round for intersection. Only regions mixed in both trees recurse.
+ * Returns a new tree, with uniform quadrants merged back into leaves.
+ */
+QuadTreeNode* combineMasks(QuadTreeNode* a, QuadTreeNode* b, bool intersect) {
+    for (int pass = 0; pass < 2; pass++, swap(a, b)) {
+        if (a->isLeaf) {
+            bool bit = a->value != 0;
+            // Absorbing leaf: 1 for union, 0 for intersection
+            return bit != intersect ? new QuadTreeNode(bit) : copyAsMask(b);
+        }
+    }
+    return joinQuadrants(combineMasks(a->topLeft, b->topLeft, intersect),
+                         combineMasks(a->topRight, b->topRight, intersect),
+                         combineMasks(a->bottomLeft, b->bottomLeft, intersect),
+                         combineMasks(a->bottomRight, b->bottomRight, intersect));
+}
+
+QuadTreeNode* maskUnion(QuadTreeNode* a, QuadTreeNode* b) {
+    return combineMasks(a, b, false);
+}
+
+QuadTreeNode* maskIntersection(QuadTreeNode* a, QuadTreeNode* b) {
+    return combineMasks(a, b, true);
+}
+
+/**
+ * Satellite-style binary mask: a few random filled disks on an empty background
+ */
+vector<vector<int>> makeMask(int side, int disks, int seed) {
+    mt19937 rng(seed);
+    vector<array<long long, 3>> circles(disks);
+    for (auto& [cx, cy, r] : circles) {
+        cx = rng() % side, cy = rng() % side, r = side / 16 + rng() % (side / 6);
+    }
+    vector<vector<int>> img(side, vector<int>(side, 0));
+    for (int x = 0; x < side; x++) {
+        for (auto& [cx, cy, r] : circles) {
+            long long dx = x - cx;
+            if (dx * dx > r * r) continue;
+            long long half = 0;
+            while ((half + 1) * (half + 1) + dx * dx <= r * r) half++;
+            for (long long y = max(0LL, cy - half); y <= min((long long)side - 1, cy + half); y++) img[x][y] = 1;
+        }
+    }
+    return img;
+}
+
+double elapsedMs(chrono::steady_clock::time_point start) {
+    return chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+}
+
+void benchmark(int side) {
+    vector<vector<int>> a = makeMask(side, 12, side), b = makeMask(side, 12, side + 1);
+    cout << "\nImage " << side << "x" << side << " (" << thread::hardware_concurrency() << " hardware threads)" << endl;
+
+    auto start = chrono::steady_clock::now();
+    QuadTreeNode* sequential = makeQuadTree(a);
+    cout << "  Sequential build:          " << elapsedMs(start) << " ms" << endl;
+    for (int levels : {1, 2}) {
+        start = chrono::steady_clock::now();
+        QuadTreeNode* parallel = makeQuadTree(a, levels);
+        double ms = elapsedMs(start);
+        cout << "  Parallel build, " << (1 << (2 * levels)) << " tasks:   " << ms << " ms (same tree: "
+             << (sameTree(sequential, parallel) ? "yes" : "no") << ")" << endl;
+        deleteTree(parallel);
+    }
+
+    QuadTreeNode* other = makeQuadTree(b, 2);
+    QuadTreeRegionIndex index(sequential, side, side);
+    mt19937 rng(1);
+    int pixelQueries = 4000000;
+    long long checksum = 0;
+    start = chrono::steady_clock::now();
+    for (int q = 0; q < pixelQueries; q++) checksum += index.valueAt(rng() % side, rng() % side);
+    cout << "  valueAt:   " << pixelQueries / elapsedMs(start) / 1000 << " M queries/s (ones hit " << checksum << ")" << endl;
+
+    int rectQueries = 200000;
+    start = chrono::steady_clock::now();
+    checksum = 0;
+    for (int q = 0; q < rectQueries; q++) {
+        int r1 = rng() % side, r2 = rng() % side, c1 = rng() % side, c2 = rng() % side;
+        checksum += index.countOnes(min(r1, r2), min(c1, c2), max(r1, r2), max(c1, c2));
+    }
+    double treeMs = elapsedMs(start);
+    int scanQueries = 50;
+    start = chrono::steady_clock::now();
+    long long scanned = 0;
+    for (int q = 0; q < scanQueries; q++) {
+        int r1 = rng() % side, r2 = rng() % side, c1 = rng() % side, c2 = rng() % side;
+        for (int x = min(r1, r2); x <= max(r1, r2); x++)
+            for (int y = min(c1, c2); y <= max(c1, c2); y++) scanned += a[x][y] == 1;
+    }
+    double scanMs = elapsedMs(start);
+    cout << "  countOnes: " << rectQueries / treeMs * 1000 << " rectangles/s on the tree, "
+         << scanQueries / scanMs * 1000 << " rectangles/s scanning pixels (ones " << checksum << " / " << scanned << ")" << endl;
+
+    start = chrono::steady_clock::now();
+    QuadTreeNode* both = maskUnion(sequential, other);
+    QuadTreeNode* common = maskIntersection(sequential, other);
+    double combineMs = elapsedMs(start);
+    start = chrono::steady_clock::now();
+    long long pixelUnion = 0, pixelCommon = 0;
+    for (int x = 0; x < side; x++) {
+        for (int y = 0; y < side; y++) {
+            pixelUnion += a[x][y] | b[x][y];
+            pixelCommon += a[x][y] & b[x][y];
+        }
+    }
+    double pixelMs = elapsedMs(start);
+    long long unionOnes = QuadTreeRegionIndex(both, side, side).countOnes(0, 0, side - 1, side - 1);
+    long long commonOnes = QuadTreeRegionIndex(common, side, side).countOnes(0, 0, side - 1, side - 1);
+    cout << "  Union + intersection: " << combineMs << " ms on trees, " << pixelMs << " ms per pixel (ones "
+         << unionOnes << " / " << commonOnes << ", match: " << (unionOnes == pixelUnion && commonOnes == pixelCommon ? "yes" : "no")
+         << ")" << endl;
+
+    deleteTree(sequential);
+    deleteTree(other);
+    deleteTree(both);
+    deleteTree(common);
+}
+
+int main() {
+    cout << "PARALLEL QUADTREE AND REGION QUERIES DEMO" << endl;
+    cout << "=========================================" << endl;
+
+    vector<vector<int>> mask = {
+        {1, 1, 0, 0},
+        {1, 1, 0, 1},
+        {0, 0, 1, 1},
+        {0, 0, 1, 1}
+    };
+    vector<vector<int>> other = {
+        {0, 0, 0, 0},
+        {0, 0, 1, 1},
+        {0, 0, 1, 1},
+        {1, 1, 1, 1}
+    };
+    QuadTreeNode* root = makeQuadTree(mask, 1);
+    QuadTreeRegionIndex index(root, 4, 4);
+    cout << "\nvalueAt(1, 3) = " << index.valueAt(1, 3) << endl;
+    cout << "Ones in rows 0..1, cols 1..3: " << index.countOnes(0, 1, 1, 3) << endl;
+    QuadTreeNode* otherRoot = makeQuadTree(other);
+    QuadTreeNode* both = maskUnion(root, otherRoot);
+    QuadTreeNode* common = maskIntersection(root, otherRoot);
+    cout << "Ones in union: " << QuadTreeRegionIndex(both, 4, 4).countOnes(0, 0, 3, 3)
+         << ", in intersection: " << QuadTreeRegionIndex(common, 4, 4).countOnes(0, 0, 3, 3) << endl;
+    deleteTree(root);
+    deleteTree(otherRoot);
+    deleteTree(both);
+    deleteTree(common);
+
+    // Every query against the pixels. The midpoint split only yields valid quadrants on
+    // power-of-two squares (a 3-wide region leaves an empty one), so those are tested.
+    for (int side : {1, 2, 8, 64, 128}) {
+        vector<vector<int>> a = makeMask(max(side, 16), 3, side), b = makeMask(max(side, 16), 3, side + 7);
+        a.resize(side), b.resize(side);
+        for (auto& row : a) row.resize(side);
+        for (auto& row : b) row.resize(side);
+        QuadTreeNode* treeA = makeQuadTree(a, 2);
+        QuadTreeNode* treeB = makeQuadTree(b);
+        QuadTreeNode* sequentialA = makeQuadTree(a);
+        assert(sameTree(treeA, sequentialA));
+        QuadTreeNode* u = maskUnion(treeA, treeB);
+        QuadTreeNode* n = maskIntersection(treeA, treeB);
+        QuadTreeRegionIndex indexA(treeA, side, side), indexU(u, side, side), indexN(n, side, side);
+        for (int x = 0; x < side; x++) {
+            for (int y = 0; y < side; y++) {
+                assert(indexA.valueAt(x, y) == a[x][y]);
+                assert(indexU.valueAt(x, y) == (a[x][y] | b[x][y]));
+                assert(indexN.valueAt(x, y) == (a[x][y] & b[x][y]));
+            }
+        }
+        mt19937 rng(side);
+        for (int q = 0; q < 200; q++) {
+            int r1 = rng() % side, r2 = rng() % side, c1 = rng() % side, c2 = rng() % side;
+            if (r1 > r2) swap(r1, r2);
+            if (c1 > c2) swap(c1, c2);
+            long long expected = 0;
+            for (int x = r1; x <= r2; x++)
+                for (int y = c1; y <= c2; y++) expected += a[x][y] == 1;
+            assert(indexA.countOnes(r1, c1, r2, c2) == expected);
+        }
+        for (QuadTreeNode* tree : {treeA, treeB, sequentialA, u, n}) deleteTree(tree);
+    }
+    cout << "Parallel build and region queries match the pixels" << endl;
+
+    benchmark(4096);
+    benchmark(8192);
+    return 0;
+}
+
+/*
+================================================================================
+                              PROBLEM DESCRIPTION
+================================================================================
+
+Same quadtree as ImageRepresentationUsingQuadtree.cpp, used to compress and compare
+large satellite masks. Only makeQuadTree and printTree existed: a single-threaded
+build and no way to query the result.
+
+PARALLEL BUILD:
+- buildQuadTreeParallel splits exactly like buildQuadTree. For the top
+  `parallelLevels` levels the topRight, bottomLeft and bottomRight quadrants run as
+  std::async tasks while the caller builds topLeft, then the four are joined with
+  the same merge rule. parallelLevels = 1 gives 4 subtrees in flight, 2 gives 16.
+- The result is node-for-node the same tree as the sequential build.
+
+REGION QUERIES (QuadTreeRegionIndex):
+- Flatten the tree once into preorder arrays with subtree sizes and a count of
+  1 pixels per node.
+- valueAt(row, col): descend one child per level -> O(depth).
+- countOnes(rectangle): nodes fully inside add their stored count, nodes outside
+  add 0, only nodes on the rectangle border recurse -> O(border nodes).
+
+MASK UNION / INTERSECTION (combineMasks):
+- A leaf decides its whole region: union with a 1 leaf is 1, with a 0 leaf it is
+  the other tree; intersection the other way round.
+- Only regions that are mixed in both trees recurse, and the result merges equal
+  sibling leaves back into one.
+
+TIME COMPLEXITY:
+- Build: O(pixels) work, split across 4^parallelLevels tasks
+- valueAt: O(depth), countOnes: O(nodes on the rectangle border)
+- Union / intersection: O(nodes of the two trees)
+
+================================================================================
+*/
@@ -0,0 +1,570 @@
+/**
+ * COMPACT SERIALIZED QUADTREE WITH STREAMING DECODE
+ *
+ * Encodes the QuadTreeNode tree of ImageRepresentationUsingQuadtree.cpp as a flat
+ * byte buffer (2 bits per node in preorder plus explicit leaf values) and reads it in
+ * place, e.g. straight from an mmap'ed file: pixel queries and sub-rectangle decodes
+ * touch only the part of the stream that covers them.
+ */
+
+#include <iostream>
+#include <vector>
+#include <array>
+#include <random>
+#include <chrono>
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+#include <cstdio>
+#include <stdexcept>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+using namespace std;
+
+/**
+ * Simple QuadTree Node Structure (same as ImageRepresentationUsingQuadtree.cpp)
+ */
+struct QuadTreeNode {
+    int value;                    // Pixel value (only used for leaves)
+    bool isLeaf;                  // true = leaf, false = internal node
+    QuadTreeNode* topLeft;        // Pointer to top-left child
+    QuadTreeNode* topRight;       // Pointer to top-right child
+    QuadTreeNode* bottomLeft;     // Pointer to bottom-left child
+    QuadTreeNode* bottomRight;    // Pointer to bottom-right child
+
+    // Constructor for leaf node
+    QuadTreeNode(int val) {
+        value = val;
+        isLeaf = true;
+        topLeft = topRight = bottomLeft = bottomRight = nullptr;
+    }
+
+    // Constructor for internal node
+    QuadTreeNode(QuadTreeNode* tl, QuadTreeNode* tr, QuadTreeNode* bl, QuadTreeNode* br) {
+        value = 0;  // Not used for internal nodes
+        isLeaf = false;
+        topLeft = tl;
+        topRight = tr;
+        bottomLeft = bl;
+        bottomRight = br;
+    }
+};
+
+/**
+ * Build quadtree for a rectangular region (same as the original)
+ */
+QuadTreeNode* buildQuadTree(vector<vector<int>>& img, int x1, int x2, int y1, int y2) {
+    if (x1 == x2 && y1 == y2) {
+        return new QuadTreeNode(img[x1][y1]);
+    }
+    int midX = (x1 + x2) / 2;
+    int midY = (y1 + y2) / 2;
+    QuadTreeNode* tl = buildQuadTree(img, x1, midX, y1, midY);
+    QuadTreeNode* tr = buildQuadTree(img, x1, midX, midY + 1, y2);
+    QuadTreeNode* bl = buildQuadTree(img, midX + 1, x2, y1, midY);
+    QuadTreeNode* br = buildQuadTree(img, midX + 1, x2, midY + 1, y2);
+    if (tl->isLeaf && tr->isLeaf && bl->isLeaf && br->isLeaf &&
+        tl->value == tr->value && tl->value == bl->value && tl->value == br->value) {
+        int commonValue = tl->value;
+        delete tl;
+        delete tr;
+        delete bl;
+        delete br;
+        return new QuadTreeNode(commonValue);
+    }
+    return new QuadTreeNode(tl, tr, bl, br);
+}
+
+QuadTreeNode* makeQuadTree(vector<vector<int>>& img) {
+    if (img.empty() || img[0].empty()) {
+        return nullptr;
+    }
+    return buildQuadTree(img, 0, img.size() - 1, 0, img[0].size() - 1);
+}
+
+void deleteTree(QuadTreeNode* node) {
+    if (!node) return;
+    if (!node->isLeaf) {
+        deleteTree(node->topLeft);
+        deleteTree(node->topRight);
+        deleteTree(node->bottomLeft);
+        deleteTree(node->bottomRight);
+    }
+    delete node;
+}
+
+/**
+ * Serialized layout, every section 8-byte aligned, little-endian:
+ *
+ *   QuadTreeStreamHeader                      32 bytes
+ *   directory  (4^directoryDepth entries)     {uint32 node, uint32 value} each
+ *   structure  (nodeCount 2-bit codes)        uint64 words, node i at bits 2i..2i+1
+ *   values     (valueCount int32)             one per explicit-value leaf, in preorder
+ *
+ * Node codes: 0 = internal node (its 4 children follow in preorder), 1 = leaf 0,
+ * 2 = leaf 1, 3 = leaf whose value is the next entry of `values`. Binary masks need
+ * no values at all.
+ *
+ * The directory splits the image into a 2^d x 2^d grid of cells and stores, for each
+ * cell, where its subtree starts: the node position in the structure and how many
+ * explicit values precede it. A cell inside a larger leaf points at that leaf. Readers
+ * start there and only ever scan one cell's subtree.
+ */
+struct QuadTreeStreamHeader {
+    char magic[4];           // "QTS1"
+    uint32_t side;           // Power-of-two image side
+    uint8_t levels;          // log2(side)
+    uint8_t directoryDepth;  // d
+    uint16_t reserved;
+    uint32_t nodeCount;
+    uint32_t valueCount;
+    uint32_t reserved2;
+    uint64_t structureWords;
+};
+static_assert(sizeof(QuadTreeStreamHeader) == 32, "header must stay 32 bytes");
+
+struct DirectoryEntry {
+    uint32_t node;
+    uint32_t value;
+};
+
+class QuadTreeStreamWriter {
+private:
+    vector<uint64_t> structure;
+    vector<int32_t> values;
+    vector<DirectoryEntry> directory;
+    uint32_t nodeCount = 0;
+    int directoryDepth = 0;
+    int cellSize = 1;
+
+    void emit(uint32_t code) {
+        if (nodeCount % 32 == 0) structure.push_back(0);
+        structure.back() |= (uint64_t)code << (2 * (nodeCount % 32));
+        nodeCount++;
+    }
+
+    void write(QuadTreeNode* node, int depth, int x, int y, int size) {
+        DirectoryEntry here = {nodeCount, (uint32_t)values.size()};
+        if (depth == directoryDepth) {
+            directory[(x / cellSize << directoryDepth) + y / cellSize] = here;
+        } else if (node->isLeaf && depth < directoryDepth) {
+            for (int cx = x; cx < x + size; cx += cellSize)
+                for (int cy = y; cy < y + size; cy += cellSize) directory[(cx / cellSize << directoryDepth) + cy / cellSize] = here;
+        }
+        if (node->isLeaf) {
+            if (node->value == 0 || node->value == 1) {
+                emit(1 + node->value);
+            } else {
+                emit(3);
+                values.push_back(node->value);
+            }
+            return;
+        }
+        emit(0);
+        int half = size / 2;
+        write(node->topLeft, depth + 1, x, y, half);
+        write(node->topRight, depth + 1, x, y + half, half);
+        write(node->bottomLeft, depth + 1, x + half, y, half);
+        write(node->bottomRight, depth + 1, x + half, y + half, half);
+    }
+
+public:
+    /**
+     * Cells of the directory are `cellSide` pixels wide (clamped to the image)
+     */
+    static vector<uint8_t> serialize(QuadTreeNode* root, int side, int cellSide = 128) {
+        if (!root || side <= 0 || (side & (side - 1)) != 0) {
+            throw invalid_argument("Serialization needs a tree over a power-of-two square image");
+        }
+        QuadTreeStreamWriter writer;
+        int levels = 0;
+        while ((1 << levels) < side) levels++;
+        writer.cellSize = min(side, max(1, cellSide));
+        while ((side >> writer.directoryDepth) > writer.cellSize) writer.directoryDepth++;
+        writer.cellSize = side >> writer.directoryDepth;
+        writer.directory.resize((size_t)1 << (2 * writer.directoryDepth));
+        writer.write(root, 0, 0, 0, side);
+
+        QuadTreeStreamHeader header = {};
+        memcpy(header.magic, "QTS1", 4);
+        header.side = side;
+        header.levels = levels;
+        header.directoryDepth = writer.directoryDepth;
+        header.nodeCount = writer.nodeCount;
+        header.valueCount = writer.values.size();
+        header.structureWords = writer.structure.size();
+
+        size_t directoryBytes = writer.directory.size() * sizeof(DirectoryEntry);
+        size_t structureBytes = writer.structure.size() * sizeof(uint64_t);
+        size_t valueBytes = writer.values.size() * sizeof(int32_t);
+        vector<uint8_t> bytes(sizeof(header) + directoryBytes + structureBytes + valueBytes);
+        uint8_t* out = bytes.data();
+        memcpy(out, &header, sizeof(header));
+        memcpy(out += sizeof(header), writer.directory.data(), directoryBytes);
+        memcpy(out += directoryBytes, writer.structure.data(), structureBytes);
+        memcpy(out += structureBytes, writer.values.data(), valueBytes);
+        return bytes;
+    }
+};
+
+/**
+ * Reads a serialized tree in place. It keeps only pointers into the caller's buffer,
+ * which must outlive the reader (an mmap'ed file works as is). Nothing is decoded
+ * up front.
+ */
+class QuadTreeStreamReader {
+private:
+    QuadTreeStreamHeader header;
+    const DirectoryEntry* directory;
+    const uint64_t* structure;
+    const int32_t* values;
+    int cellSize;
+
+    uint32_t code(uint32_t node) const {
+        return (structure[node >> 5] >> (2 * (node & 31))) & 3;
+    }
+
+    int leafValue(uint32_t leafCode, uint32_t& valueIndex) const {
+        return leafCode == 3 ? values[valueIndex++] : (int)leafCode - 1;
+    }
+
+    /**
+     * Position just past the subtree starting at `node`; advances valueIndex past
+     * the subtree's explicit values
+     */
+    uint32_t skip(uint32_t node, uint32_t& valueIndex) const {
+        uint32_t pending = 1;
+        while (pending) {
+            uint32_t c = code(node++);
+            if (c == 0) {
+                pending += 3;
+            } else {
+                pending--;
+                valueIndex += c == 3;
+            }
+        }
+        return node;
+    }
+
+    /**
+     * Writes the part of the subtree at `node` (region x, y, size) that falls inside
+     * the output rectangle; children outside it are skipped. Returns the position
+     * just past the subtree.
+     */
+    uint32_t decodeInto(uint32_t node, uint32_t& valueIndex, int x, int y, int size,
+                        int r1, int c1, int r2, int c2, vector<int>& out) const {
+        uint32_t c = code(node++);
+        if (c != 0) {
+            int value = leafValue(c, valueIndex);
+            int width = c2 - c1 + 1;
+            for (int row = max(x, r1); row <= min(x + size - 1, r2); row++) {
+                int* line = out.data() + (size_t)(row - r1) * width;
+                fill(line + max(y, c1) - c1, line + min(y + size - 1, c2) - c1 + 1, value);
+            }
+            return node;
+        }
+        int half = size / 2;
+        for (int child = 0; child < 4; child++) {
+            int cx = x + (child >> 1) * half, cy = y + (child & 1) * half;
+            bool overlaps = cx <= r2 && cx + half - 1 >= r1 && cy <= c2 && cy + half - 1 >= c1;
+            node = overlaps ? decodeInto(node, valueIndex, cx, cy, half, r1, c1, r2, c2, out) : skip(node, valueIndex);
+        }
+        return node;
+    }
+
+public:
+    /**
+     * Streams come from other services, so the header is validated before anything
+     * is indexed: d <= levels <= 30, side == 2^levels, every node code fits in the
+     * structure words, and every section fits in the buffer. Sizes are compared in
+     * 64-bit math against what is left of the buffer, so a hostile count cannot
+     * overflow them.
+     * @throws invalid_argument if the buffer is not a well-formed stream
+     */
+    QuadTreeStreamReader(const uint8_t* data, size_t size) {
+        if (size < sizeof(QuadTreeStreamHeader)) {
+            throw invalid_argument("Buffer too small for a quadtree stream");
+        }
+        memcpy(&header, data, sizeof(header));
+        if (memcmp(header.magic, "QTS1", 4) != 0) {
+            throw invalid_argument("Not a quadtree stream");
+        }
+        if (header.levels > 30 || header.directoryDepth > header.levels || header.side != 1u << header.levels) {
+            throw invalid_argument("Quadtree stream has an invalid side or directory depth");
+        }
+        uint64_t remaining = size - sizeof(header);
+        uint64_t directoryBytes = (uint64_t(1) << (2 * header.directoryDepth)) * sizeof(DirectoryEntry);
+        if (directoryBytes > remaining || header.structureWords > (remaining - directoryBytes) / sizeof(uint64_t)) {
+            throw invalid_argument("Truncated quadtree stream");
+        }
+        uint64_t structureBytes = header.structureWords * sizeof(uint64_t);
+        if (uint64_t(header.valueCount) * sizeof(int32_t) > remaining - directoryBytes - structureBytes) {
+            throw invalid_argument("Truncated quadtree stream");
+        }
+        if (header.nodeCount == 0 || header.nodeCount > 32 * header.structureWords) {
+            throw invalid_argument("Quadtree stream node count does not match its structure");
+        }
+        // Sections are 8-byte aligned relative to the buffer start
+        directory = reinterpret_cast<const DirectoryEntry*>(data + sizeof(header));
+        structure = reinterpret_cast<const uint64_t*>(data + sizeof(header) + directoryBytes);
+        values = reinterpret_cast<const int32_t*>(data + sizeof(header) + directoryBytes + structureBytes);
+        cellSize = header.side >> header.directoryDepth;
+    }
+
+    int side() const {
+        return header.side;
+    }
+
+    uint32_t nodeCount() const {
+        return header.nodeCount;
+    }
+
+    /**
+     * Directory cell, then one child per level, skipping the earlier siblings
+     */
+    int valueAt(int row, int col) const {
+        DirectoryEntry start = directory[(row / cellSize << header.directoryDepth) + col / cellSize];
+        uint32_t node = start.node, valueIndex = start.value;
+        int size = cellSize;
+        uint32_t c;
+        while ((c = code(node)) == 0) {
+            node++;
+            size /= 2;
+            int child = ((row & size) ? 2 : 0) + ((col & size) ? 1 : 0);
+            for (int k = 0; k < child; k++) node = skip(node, valueIndex);
+        }
+        return leafValue(c, valueIndex);
+    }
+
+    /**
+     * Pixels of rows [r1, r2] x cols [c1, c2], row-major. Only directory cells that
+     * overlap the rectangle are read, and inside them only overlapping subtrees.
+     */
+    vector<int> decodeRect(int r1, int c1, int r2, int c2) const {
+        vector<int> out((size_t)(r2 - r1 + 1) * (c2 - c1 + 1));
+        for (int cellRow = r1 / cellSize; cellRow <= r2 / cellSize; cellRow++) {
+            for (int cellCol = c1 / cellSize; cellCol <= c2 / cellSize; cellCol++) {
+                DirectoryEntry start = directory[(cellRow << header.directoryDepth) + cellCol];
+                uint32_t valueIndex = start.value;
+                uint32_t c = code(start.node);
+                int x = cellRow * cellSize, y = cellCol * cellSize;
+                if (c != 0) {
+                    // A leaf covering this cell, possibly larger than it: clip to the cell
+                    int value = leafValue(c, valueIndex), width = c2 - c1 + 1;
+                    for (int row = max(x, r1); row <= min(x + cellSize - 1, r2); row++) {
+                        int* line = out.data() + (size_t)(row - r1) * width;
+                        fill(line + max(y, c1) - c1, line + min(y + cellSize - 1, c2) - c1 + 1, value);
+                    }
+                } else {
+                    decodeInto(start.node, valueIndex, x, y, cellSize, r1, c1, r2, c2, out);
+                }
+            }
+        }
+        return out;
+    }
+};
+
+/**
+ * Satellite-style binary mask: a few random filled disks on an empty background
+ */
+vector<vector<int>> makeMask(int side, int disks, int seed) {
+    mt19937 rng(seed);
+    vector<array<long long, 3>> circles(disks);
+    for (auto& [cx, cy, r] : circles) {
+        cx = rng() % side, cy = rng() % side, r = side / 16 + rng() % (side / 6);
+    }
+    vector<vector<int>> img(side, vector<int>(side, 0));
+    for (int x = 0; x < side; x++) {
+        for (auto& [cx, cy, r] : circles) {
+            long long dx = x - cx;
+            if (dx * dx > r * r) continue;
+            long long half = 0;
+            while ((half + 1) * (half + 1) + dx * dx <= r * r) half++;
+            for (long long y = max(0LL, cy - half); y <= min((long long)side - 1, cy + half); y++) img[x][y] = 1;
+        }
+    }
+    return img;
+}
+
+double elapsedMs(chrono::steady_clock::time_point start) {
+    return chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+}
+
+/**
+ * Writes the stream to a file, maps it read-only and queries the mapping directly
+ */
+void benchmark(int side) {
+    vector<vector<int>> img = makeMask(side, 12, side);
+    QuadTreeNode* root = makeQuadTree(img);
+    auto start = chrono::steady_clock::now();
+    vector<uint8_t> bytes = QuadTreeStreamWriter::serialize(root, side);
+    double encodeMs = elapsedMs(start);
+    deleteTree(root);
+
+    string path = "/tmp/quadtree_mask_" + to_string(side) + ".qts";
+    FILE* file = fopen(path.c_str(), "wb");
+    fwrite(bytes.data(), 1, bytes.size(), file);
+    fclose(file);
+    int fd = open(path.c_str(), O_RDONLY);
+    struct stat info;
+    fstat(fd, &info);
+    void* mapped = mmap(nullptr, info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (mapped == MAP_FAILED) {
+        throw runtime_error("mmap failed");
+    }
+    QuadTreeStreamReader reader(static_cast<const uint8_t*>(mapped), info.st_size);
+
+    long long pixels = (long long)side * side;
+    cout << "\nMask " << side << "x" << side << ": " << reader.nodeCount() << " nodes, " << bytes.size() << " bytes ("
+         << encodeMs << " ms to encode)" << endl;
+    cout << "  Compression: " << pixels * 4.0 / bytes.size() << "x vs int pixels, " << pixels / 8.0 / bytes.size()
+         << "x vs a 1-bit bitmap, " << reader.nodeCount() * (double)sizeof(QuadTreeNode) / bytes.size()
+         << "x vs the pointer tree" << endl;
+
+    mt19937 rng(1);
+    int queries = 2000000;
+    long long ones = 0;
+    start = chrono::steady_clock::now();
+    for (int q = 0; q < queries; q++) ones += reader.valueAt(rng() % side, rng() % side);
+    cout << "  valueAt:             " << queries / elapsedMs(start) / 1000 << " M queries/s (ones " << ones << ")" << endl;
+
+    int windows = 20000, window = 256;
+    ones = 0;
+    start = chrono::steady_clock::now();
+    for (int q = 0; q < windows; q++) {
+        int r = rng() % (side - window), c = rng() % (side - window);
+        vector<int> tile = reader.decodeRect(r, c, r + window - 1, c + window - 1);
+        ones += tile[window * window / 2];
+    }
+    double windowMs = elapsedMs(start);
+    cout << "  decodeRect 256x256:  " << windows / windowMs * 1000 << " tiles/s, "
+         << (double)windows * window * window / windowMs / 1e6 << " G pixels/s" << endl;
+
+    start = chrono::steady_clock::now();
+    vector<int> full = reader.decodeRect(0, 0, side - 1, side - 1);
+    double fullMs = elapsedMs(start);
+    bool same = true;
+    for (int x = 0; x < side && same; x++) same = equal(img[x].begin(), img[x].end(), full.begin() + (size_t)x * side);
+    cout << "  Full decode:         " << fullMs << " ms, " << pixels / fullMs / 1e6 << " G pixels/s (matches image: "
+         << (same ? "yes" : "no") << ")" << endl;
+
+    munmap(mapped, info.st_size);
+    remove(path.c_str());
+}
+
+int main() {
+    cout << "SERIALIZED QUADTREE DEMO" << endl;
+    cout << "========================" << endl;
+
+    vector<vector<int>> large = {
+        {1, 1, 2, 2},
+        {1, 1, 2, 2},
+        {3, 4, 5, 5},
+        {6, 7, 5, 5}
+    };
+    QuadTreeNode* root = makeQuadTree(large);
+    vector<uint8_t> bytes = QuadTreeStreamWriter::serialize(root, 4, 2);
+    QuadTreeStreamReader reader(bytes.data(), bytes.size());
+    cout << "\n4x4 image: " << reader.nodeCount() << " nodes, " << bytes.size() << " bytes" << endl;
+    cout << "valueAt(3, 1) = " << reader.valueAt(3, 1) << endl;
+    cout << "Rows 1..2, cols 1..2: ";
+    for (int value : reader.decodeRect(1, 1, 2, 2)) cout << value << " ";
+    cout << endl;
+    deleteTree(root);
+
+    // Every pixel and random rectangles against the image, for several directory depths
+    for (int side : {1, 2, 16, 64, 256}) {
+        mt19937 rng(side);
+        vector<vector<int>> img = makeMask(max(side, 16), 4, side);
+        img.resize(side);
+        for (auto& row : img) row.resize(side);
+        for (int k = 0; k < side; k++) img[rng() % side][rng() % side] = rng() % 5; // Some explicit values
+        QuadTreeNode* tree = makeQuadTree(img);
+        for (int cellSide : {1, 4, 32, 1024}) {
+            vector<uint8_t> stream = QuadTreeStreamWriter::serialize(tree, side, cellSide);
+            QuadTreeStreamReader check(stream.data(), stream.size());
+            for (int x = 0; x < side; x++)
+                for (int y = 0; y < side; y++) assert(check.valueAt(x, y) == img[x][y]);
+            for (int q = 0; q < 50; q++) {
+                int r1 = rng() % side, r2 = rng() % side, c1 = rng() % side, c2 = rng() % side;
+                if (r1 > r2) swap(r1, r2);
+                if (c1 > c2) swap(c1, c2);
+                vector<int> rect = check.decodeRect(r1, c1, r2, c2);
+                for (int x = r1; x <= r2; x++)
+                    for (int y = c1; y <= c2; y++) assert(rect[(size_t)(x - r1) * (c2 - c1 + 1) + y - c1] == img[x][y]);
+            }
+        }
+        deleteTree(tree);
+    }
+    cout << "Stream decode matches the image" << endl;
+
+    // Corrupt headers are rejected before any section is indexed
+    auto rejects = [&](void (*corrupt)(QuadTreeStreamHeader&)) {
+        vector<uint8_t> bad = bytes;
+        QuadTreeStreamHeader header;
+        memcpy(&header, bad.data(), sizeof(header));
+        corrupt(header);
+        memcpy(bad.data(), &header, sizeof(header));
+        try {
+            QuadTreeStreamReader reader(bad.data(), bad.size());
+            return false;
+        } catch (const invalid_argument&) {
+            return true;
+        }
+    };
+    assert(rejects([](QuadTreeStreamHeader& h) { h.directoryDepth = 40; }));
+    assert(rejects([](QuadTreeStreamHeader& h) { h.directoryDepth = h.levels + 1; }));
+    assert(rejects([](QuadTreeStreamHeader& h) { h.levels = 31; h.side = 0; }));
+    assert(rejects([](QuadTreeStreamHeader& h) { h.side = 6; }));
+    assert(rejects([](QuadTreeStreamHeader& h) { h.side = 8; }));
+    assert(rejects([](QuadTreeStreamHeader& h) { h.nodeCount = 32 * h.structureWords + 1; }));
+    assert(rejects([](QuadTreeStreamHeader& h) { h.structureWords = uint64_t(1) << 61; }));
+    assert(rejects([](QuadTreeStreamHeader& h) { h.valueCount = 0xFFFFFFFFu; }));
+    assert(!rejects([](QuadTreeStreamHeader&) {}));
+    cout << "Corrupt stream headers are rejected" << endl;
+
+    benchmark(4096);
+    benchmark(8192);
+    return 0;
+}
+
+/*
+================================================================================
+                              PROBLEM DESCRIPTION
+================================================================================
+
+Quadtree-compressed masks (ImageRepresentationUsingQuadtree.cpp) are shipped between
+services, but the tree only exists as heap nodes with pointers. It needs a compact
+wire format that a receiver can query without rebuilding the tree.
+
+FORMAT (all sections 8-byte aligned, usable directly from mmap):
+- 32-byte header: magic, side, levels, directory depth, node / value counts
+  (readers reject d > levels, levels > 30, side != 2^levels, more nodes than
+  the structure words hold, and sections that do not fit in the buffer)
+- directory: 4^d entries {first node, explicit values before it}, one per cell of
+  a 2^d x 2^d grid (cells are 128 pixels wide by default)
+- structure: 2 bits per node in preorder
+    0 = internal, 1 = leaf 0, 2 = leaf 1, 3 = leaf with an explicit value
+- values: int32 per code-3 leaf, in preorder (none for binary masks)
+
+READING WITHOUT A FULL DECODE:
+- Preorder puts a subtree in one contiguous run of codes, so a subtree is skipped
+  by scanning its codes with a counter (+3 per internal node, -1 per leaf) and
+  counting code-3 leaves to keep the value index in step.
+- valueAt: jump to the directory cell of the pixel, then per level skip the
+  siblings before the wanted child. Work is bounded by one cell's subtree.
+- decodeRect: visit only directory cells that overlap the rectangle, recurse only
+  into children that overlap it, skip the rest, and fill leaves as spans.
+
+SIZE:
+- Binary mask: 2 bits per node + 8 bytes per directory cell, versus 48 bytes per
+  pointer node and 1 bit per pixel for a raw bitmap.
+
+LIMITATIONS: power-of-two square images (the same ones the midpoint split handles),
+little-endian hosts.
+
+================================================================================
+*/
@@ -3,6 +3,7 @@
 #include <set>
 #include <map>
 #include <queue>
+#include "../DSU.h"
 using namespace std;
 
 // Simple type alias for coordinates - much cleaner than custom struct!
@@ -178,42 +179,14 @@ public:
 // =============================================================================
 class TerrainUnionFind {
 private:
-    map<Point, Point> parent;  // Point -> Parent mapping
-    map<Point, int> rank;      // For union by rank optimization
+    // Shared DSU from DSU.h: points are hashed to dense ids once, then find / union
+    // run over flat arrays with path halving and union by size
+    HashedDSU<Point, DSUPairHash> dsu;
     int islandCount;
     
     // 4-directional neighbors
     vector<Point> directions = {{0, 1}, {0, -1}, {1, 0}, {-1, 0}};
     
-    // Find root with path compression - O(α(n))
-    Point find(Point p) {
-        if (parent[p] == p) {
-            return p;
-        }
-        // Path compression: make all nodes point directly to root
-        return parent[p] = find(parent[p]);
-    }
-    
-    // Union two components by rank - O(α(n))
-    bool unionSets(Point p1, Point p2) {
-        Point root1 = find(p1);
-        Point root2 = find(p2);
-        
-        if (root1 == root2) return false;  // Already in same set
-        
-        // Union by rank: attach smaller tree under bigger tree
-        if (rank[root1] < rank[root2]) {
-            parent[root1] = root2;
-        } else if (rank[root1] > rank[root2]) {
-            parent[root2] = root1;
-        } else {
-            parent[root2] = root1;
-            rank[root1]++;
-        }
-        
-        return true;  // Successfully merged two sets
-    }
-    
 public:
     TerrainUnionFind() : islandCount(0) {}
     
@@ -222,19 +195,16 @@ public:
         Point newPoint = {x, y};
         
         // If already exists, do nothing
-        if (parent.count(newPoint)) return;
+        if (!dsu.add(newPoint)) return;
         
-        // Initialize new point as its own parent
-        parent[newPoint] = newPoint;
-        rank[newPoint] = 0;
         islandCount++;  // Initially, new land is its own island
         
         // Check all 4 neighbors and union if they are land
         for (auto& dir : directions) {
             Point neighbor = {newPoint.first + dir.first, newPoint.second + dir.second};
             
-            if (parent.count(neighbor)) {  // If neighbor is land
-                if (unionSets(newPoint, neighbor)) {
+            if (dsu.contains(neighbor)) {  // If neighbor is land
+                if (dsu.unionBySize(newPoint, neighbor)) {
                     islandCount--;  // Two islands merged into one
                 }
             }
@@ -243,7 +213,7 @@ public:
     
     // Check if point is land - O(1)
     bool isLand(int x, int y) {
-        return parent.count({x, y});
+        return dsu.contains({x, y});
     }
     
     // Get island count in constant time - O(1)
@@ -253,8 +223,11 @@ public:
     
     void printLands() {
         cout << "UnionFind - Land cells: ";
-        for (const auto& pair : parent) {
-            cout << "(" << pair.first.first << "," << pair.first.second << ") ";
+        // Same order as the std::map this used to iterate
+        vector<Point> lands = dsu.elements();
+        sort(lands.begin(), lands.end());
+        for (const auto& p : lands) {
+            cout << "(" << p.first << "," << p.second << ") ";
         }
         cout << endl;
     }
@@ -429,8 +402,8 @@ DFS SET APPROACH:
 - Space: O(number_of_lands) - sparse representation
 
 UNION-FIND APPROACH:
-- addLand(): O(α(n)) - nearly constant with path compression
-- isLand(): O(1) - map lookup
+- addLand(): O(α(n)) - nearly constant with path halving (shared DSU.h)
+- isLand(): O(1) - hash lookup
 - getIslands(): O(1) - return cached count
 - Space: O(number_of_lands) - sparse representation
 
@@ -0,0 +1,342 @@
+#include<bits/stdc++.h>
+
+using namespace std;
+
+// Ancestor / lowest-common-manager index. A DFS numbers every employee with an entry
+// time tin and the last entry time inside their org tout, so "is X in Y's org" is two
+// comparisons. The DFS order also feeds a sparse table of min-depth employees, which
+// answers the lowest common manager with one O(1) range-minimum query.
+// Updates only mark the index dirty; it is rebuilt in O(n log n) on the next query.
+class OrganisationHierrachyAncestorIndex {
+  private:
+    unordered_map<string, int> employeeId; // name -> interned id
+    vector<string> employeeName; // id -> name
+    vector<int> managerOf; // id -> manager id (-1 for a root)
+    vector<vector<int>> reportees; // id -> direct reportee ids
+
+    bool dirty = false;
+    vector<int> tin, tout; // org of x is the DFS order range [tin[x], tout[x]]
+    vector<int> depth, rootOf;
+    vector<int> order; // DFS order -> id
+    vector<vector<int>> sparse; // sparse[k][i] = min-depth id in order[i .. i + 2^k)
+    vector<int> logTable;
+
+    int intern(const string& employee) {
+        auto it = this->employeeId.find(employee);
+        if(it != this->employeeId.end()) return it->second;
+        int id = this->employeeName.size();
+        this->employeeId.emplace(employee, id);
+        this->employeeName.push_back(employee);
+        this->managerOf.push_back(-1);
+        this->reportees.emplace_back();
+        this->dirty = true;
+        return id;
+    }
+
+    int shallower(int a, int b) const {
+        return this->depth[a] <= this->depth[b] ? a : b;
+    }
+
+    void rebuild() {
+        int n = this->employeeName.size();
+        this->tin.assign(n, 0);
+        this->tout.assign(n, 0);
+        this->depth.assign(n, 0);
+        this->rootOf.assign(n, 0);
+        this->order.clear();
+        this->order.reserve(n);
+
+        // Iterative DFS, deep reporting chains would overflow the call stack
+        vector<pair<int, int>> stack; // (id, next reportee index)
+        for(int root = 0; root < n; root++) {
+            if(this->managerOf[root] >= 0) continue;
+            stack.push_back({root, 0});
+            this->tin[root] = this->order.size();
+            this->order.push_back(root);
+            this->rootOf[root] = root;
+            while(!stack.empty()) {
+                auto& [id, next] = stack.back();
+                if(next == (int)this->reportees[id].size()) {
+                    this->tout[id] = (int)this->order.size() - 1;
+                    stack.pop_back();
+                    continue;
+                }
+                int reportee = this->reportees[id][next++];
+                this->tin[reportee] = this->order.size();
+                this->order.push_back(reportee);
+                this->depth[reportee] = this->depth[id] + 1;
+                this->rootOf[reportee] = this->rootOf[id];
+                stack.push_back({reportee, 0});
+            }
+        }
+
+        this->logTable.assign(n + 1, 0);
+        for(int i = 2; i <= n; i++) this->logTable[i] = this->logTable[i / 2] + 1;
+        this->sparse.assign(1, this->order);
+        for(int k = 1; (1 << k) <= n; k++) {
+            const vector<int>& prev = this->sparse[k - 1];
+            vector<int> level(n - (1 << k) + 1);
+            for(int i = 0; i < (int)level.size(); i++) {
+                level[i] = shallower(prev[i], prev[i + (1 << (k - 1))]);
+            }
+            this->sparse.push_back(move(level));
+        }
+        this->dirty = false;
+    }
+
+    void ensureBuilt() {
+        if(this->dirty) rebuild();
+    }
+
+    // Used for cycle checks while the index is dirty, so a burst of moves does not
+    // trigger a rebuild per move
+    bool reportsTo(int employee, int manager) const {
+        for(int id = employee; id >= 0; id = this->managerOf[id]) {
+            if(id == manager) return true;
+        }
+        return false;
+    }
+
+  public:
+    OrganisationHierrachyAncestorIndex() {}
+
+    int getId(const string& employee) {
+        return intern(employee);
+    }
+
+    void addNewReportee(int manager, int reportee) {
+        if(manager == reportee) {
+            throw invalid_argument(this->employeeName[reportee] + " cannot report to themselves");
+        }
+        if(this->managerOf[reportee] >= 0) {
+            moveReportee(reportee, manager);
+            return;
+        }
+        // A reportee without reportees of their own cannot close a cycle
+        if(!this->reportees[reportee].empty() && reportsTo(manager, reportee)) {
+            throw invalid_argument("Adding " + this->employeeName[reportee] + " under " + this->employeeName[manager] + " would create a cycle");
+        }
+        this->managerOf[reportee] = manager;
+        this->reportees[manager].push_back(reportee);
+        this->dirty = true;
+    }
+
+    void addNewReportee(const string& manager, const string& reportee) {
+        int managerId = intern(manager);
+        addNewReportee(managerId, intern(reportee));
+    }
+
+    void moveReportee(int reportee, int newManager) {
+        bool cycle = this->dirty ? reportsTo(newManager, reportee) : isInOrg(newManager, reportee);
+        if(cycle) {
+            throw invalid_argument("Moving " + this->employeeName[reportee] + " under " + this->employeeName[newManager] + " would create a cycle");
+        }
+        int currentManager = this->managerOf[reportee];
+        if(currentManager >= 0) {
+            vector<int>& siblings = this->reportees[currentManager];
+            siblings.erase(find(siblings.begin(), siblings.end(), reportee));
+        }
+        this->managerOf[reportee] = newManager;
+        this->reportees[newManager].push_back(reportee);
+        this->dirty = true;
+    }
+
+    void moveReportee(const string& reportee, const string& newManager) {
+        int reporteeId = intern(reportee);
+        moveReportee(reporteeId, intern(newManager));
+    }
+
+    // O(1): the DFS order range of an org is its size plus one
+    int directOrIndirectCount(int manager) {
+        ensureBuilt();
+        return this->tout[manager] - this->tin[manager];
+    }
+
+    int directOrIndirectCount(const string& manager) {
+        auto it = this->employeeId.find(manager);
+        return it == this->employeeId.end() ? 0 : directOrIndirectCount(it->second);
+    }
+
+    // O(1): true when `employee` is `manager` or reports to them directly or indirectly
+    bool isInOrg(int employee, int manager) {
+        ensureBuilt();
+        return this->tin[manager] <= this->tin[employee] && this->tin[employee] <= this->tout[manager];
+    }
+
+    bool isInOrg(const string& employee, const string& manager) {
+        auto e = this->employeeId.find(employee), m = this->employeeId.find(manager);
+        if(e == this->employeeId.end() || m == this->employeeId.end()) return false;
+        return isInOrg(e->second, m->second);
+    }
+
+    // O(1): deepest employee whose org contains both, or -1 when they sit in different
+    // org charts. If one of them manages the other, that one is returned.
+    int lowestCommonManager(int a, int b) {
+        ensureBuilt();
+        if(a == b) return a;
+        if(this->rootOf[a] != this->rootOf[b]) return -1;
+        int l = this->tin[a], r = this->tin[b];
+        if(l > r) swap(l, r);
+        // The shallowest employee in order(l, r] is the child of the LCA on the path to r
+        l++;
+        int k = this->logTable[r - l + 1];
+        int child = shallower(this->sparse[k][l], this->sparse[k][r - (1 << k) + 1]);
+        return this->managerOf[child];
+    }
+
+    string lowestCommonManager(const string& a, const string& b) {
+        auto x = this->employeeId.find(a), y = this->employeeId.find(b);
+        if(x == this->employeeId.end() || y == this->employeeId.end()) return "";
+        int id = lowestCommonManager(x->second, y->second);
+        return id < 0 ? "" : this->employeeName[id];
+    }
+};
+
+// Baseline: walk the manager chains, O(depth) per query
+struct ManagerChainWalk {
+    const vector<int>& managerOf;
+    vector<int> mark;
+    int stamp = 0;
+
+    ManagerChainWalk(const vector<int>& managerOf) : managerOf(managerOf), mark(managerOf.size(), -1) {}
+
+    bool isInOrg(int employee, int manager) {
+        for(int id = employee; id >= 0; id = this->managerOf[id]) {
+            if(id == manager) return true;
+        }
+        return false;
+    }
+
+    int lowestCommonManager(int a, int b) {
+        this->stamp++;
+        for(int id = a; id >= 0; id = this->managerOf[id]) this->mark[id] = this->stamp;
+        for(int id = b; id >= 0; id = this->managerOf[id]) {
+            if(this->mark[id] == this->stamp) return id;
+        }
+        return -1;
+    }
+};
+
+// Random org where each hire reports to one of the previous `window` hires, then
+// `queries` isInOrg and lowestCommonManager lookups, plus a mixed run with a move every
+// `movesEvery` queries to show the lazy rebuild cost
+void benchmark(int n, int window, int queries, int movesEvery) {
+    mt19937 rng(11);
+    OrganisationHierrachyAncestorIndex index;
+    vector<int> managerOf(n, -1);
+    for(int i = 0; i < n; i++) index.getId("E" + to_string(i));
+    for(int i = 1; i < n; i++) {
+        managerOf[i] = max(0, i - 1 - (int)(rng() % window));
+        index.addNewReportee(managerOf[i], i);
+    }
+    vector<pair<int, int>> pairs(queries);
+    for(auto& [a, b] : pairs) a = rng() % n, b = rng() % n;
+
+    auto timeIt = [&](auto&& body) {
+        auto start = chrono::steady_clock::now();
+        long long checksum = body();
+        double ms = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+        return make_pair(ms, checksum);
+    };
+
+    auto build = timeIt([&]() { return (long long)index.directOrIndirectCount(0); });
+    auto indexResult = timeIt([&]() {
+        long long checksum = 0;
+        for(auto& [a, b] : pairs) checksum += index.isInOrg(a, b) + index.lowestCommonManager(a, b);
+        return checksum;
+    });
+    ManagerChainWalk walk(managerOf);
+    auto walkResult = timeIt([&]() {
+        long long checksum = 0;
+        for(auto& [a, b] : pairs) checksum += walk.isInOrg(a, b) + walk.lowestCommonManager(a, b);
+        return checksum;
+    });
+    auto mixedResult = timeIt([&]() {
+        long long checksum = 0;
+        for(int i = 0; i < queries; i++) {
+            if(i % movesEvery == 0) {
+                int reportee = 1 + rng() % (n - 1), newManager = rng() % n;
+                if(!index.isInOrg(newManager, reportee)) index.moveReportee(reportee, newManager);
+            }
+            checksum += index.lowestCommonManager(pairs[i].first, pairs[i].second);
+        }
+        return checksum;
+    });
+
+    double mqps = 2.0 * queries / indexResult.first / 1000.0;
+    cout<<"Employees: "<<n<<", query pairs: "<<queries<<", index build: "<<build.first<<" ms"<<endl;
+    cout<<"  Index:       "<<indexResult.first<<" ms ("<<mqps<<" M queries/s, checksum "<<indexResult.second<<")"<<endl;
+    cout<<"  Chain walk:  "<<walkResult.first<<" ms (checksum "<<walkResult.second<<")"<<endl;
+    cout<<"  Index with a move every "<<movesEvery<<" queries: "<<mixedResult.first<<" ms"<<endl;
+}
+
+int main() {
+    OrganisationHierrachyAncestorIndex OrganisationHierrachy;
+    OrganisationHierrachy.addNewReportee("A", "B");
+    OrganisationHierrachy.addNewReportee("A", "C");
+    OrganisationHierrachy.addNewReportee("B", "D");
+    OrganisationHierrachy.addNewReportee("B", "E");
+    OrganisationHierrachy.addNewReportee("C", "F");
+    OrganisationHierrachy.addNewReportee("C", "H");
+    OrganisationHierrachy.addNewReportee("C", "G");
+    OrganisationHierrachy.addNewReportee("F", "I");
+
+    for(string employee : {"A", "B", "C", "D", "E", "F", "G", "H", "I"}) {
+        cout<<employee<<" -> "<<OrganisationHierrachy.directOrIndirectCount(employee)<<endl;
+    }
+    cout<<"I in C's org: "<<OrganisationHierrachy.isInOrg("I", "C")<<endl;
+    cout<<"I in B's org: "<<OrganisationHierrachy.isInOrg("I", "B")<<endl;
+    cout<<"LCM(D, E) = "<<OrganisationHierrachy.lowestCommonManager("D", "E")<<endl;
+    cout<<"LCM(I, G) = "<<OrganisationHierrachy.lowestCommonManager("I", "G")<<endl;
+    cout<<"LCM(I, D) = "<<OrganisationHierrachy.lowestCommonManager("I", "D")<<endl;
+    cout<<"LCM(F, I) = "<<OrganisationHierrachy.lowestCommonManager("F", "I")<<endl;
+
+    cout<<"Updating the new reportee!!"<<endl;
+
+    OrganisationHierrachy.moveReportee("I", "B");
+    OrganisationHierrachy.addNewReportee("I", "T");
+
+    cout<<"I in C's org: "<<OrganisationHierrachy.isInOrg("I", "C")<<endl;
+    cout<<"T in B's org: "<<OrganisationHierrachy.isInOrg("T", "B")<<endl;
+    cout<<"LCM(T, D) = "<<OrganisationHierrachy.lowestCommonManager("T", "D")<<endl;
+    cout<<"LCM(T, G) = "<<OrganisationHierrachy.lowestCommonManager("T", "G")<<endl;
+
+    try {
+        OrganisationHierrachy.moveReportee("B", "T");
+    } catch(const invalid_argument& e) {
+        cout<<"Rejected: "<<e.what()<<endl;
+    }
+    try {
+        OrganisationHierrachy.addNewReportee("X", "X");
+    } catch(const invalid_argument& e) {
+        cout<<"Rejected: "<<e.what()<<endl;
+    }
+
+    benchmark(1000000, 50000, 5000000, 1000000);
+    return 0;
+}
+
+/*
+PROBLEM STATEMENT:
+Same as OrganisationHierrachy.cpp, plus two read queries at high QPS:
+- Is X in Y's org (does X report to Y directly or indirectly)?
+- Lowest common manager of X and Y.
+
+APPROACH:
+- Employee names are interned to dense ids; reportees are kept per manager.
+- A DFS from every root assigns tin[x] (position in DFS order) and tout[x] (last
+  position inside x's org). X is in Y's org iff tin[Y] <= tin[X] <= tout[Y], and
+  directOrIndirectCount(Y) = tout[Y] - tin[Y].
+- LCA on the DFS order: for tin[a] < tin[b], the shallowest employee in
+  order(tin[a], tin[b]] is the child of lca(a, b) on the path to b, so
+  lca = managerOf[that employee]. A sparse table of min-depth ids answers the
+  range minimum in O(1). Different roots have no common manager.
+- addNewReportee / moveReportee only mark the index dirty. The first query after
+  a burst of updates rebuilds it. Cycle checks use the index while it is clean and
+  walk the manager chain otherwise.
+
+TIME COMPLEXITY:
+- Rebuild: O(n log n) time and memory
+- isInOrg / lowestCommonManager / directOrIndirectCount: O(1) on a clean index
+- addNewReportee: O(depth), moveReportee: O(fan-out) plus O(depth) while dirty
+*/
@@ -0,0 +1,280 @@
+#include<bits/stdc++.h>
+
+using namespace std;
+
+// Loads a whole HR export of (manager, reportee) pairs at once. Children are stored
+// in a CSR array (childStart / children), employees are bucketed by depth with one BFS,
+// and every directAndIndirectCount is computed in a single post-order pass that walks
+// the depth levels from the leaves up, splitting each level across threads.
+class OrgChartBulkLoader {
+  private:
+    unordered_map<string, int> employeeId; // name -> dense id
+    vector<string> employeeName; // id -> name
+    vector<int> managerOf; // id -> manager id (-1 for a root)
+    vector<int> childStart; // CSR offsets, reportees of id are children[childStart[id] .. childStart[id + 1])
+    vector<int> children;
+    vector<int> levelOrder; // ids in BFS order
+    vector<int> levelStart; // levelOrder[levelStart[d] .. levelStart[d + 1]) are the ids at depth d
+    vector<int> count; // id -> direct and indirect reportee count
+
+    int intern(const string& employee) {
+        auto it = this->employeeId.find(employee);
+        if(it != this->employeeId.end()) return it->second;
+        int id = this->employeeName.size();
+        this->employeeId.emplace(employee, id);
+        this->employeeName.push_back(employee);
+        this->managerOf.push_back(-1);
+        return id;
+    }
+
+    void buildChildArray() {
+        int n = this->employeeName.size();
+        this->childStart.assign(n + 1, 0);
+        for(int id = 0; id < n; id++) {
+            if(this->managerOf[id] >= 0) this->childStart[this->managerOf[id] + 1]++;
+        }
+        for(int id = 0; id < n; id++) this->childStart[id + 1] += this->childStart[id];
+        this->children.assign(this->childStart[n], 0);
+        vector<int> next(this->childStart.begin(), this->childStart.end() - 1);
+        for(int id = 0; id < n; id++) {
+            if(this->managerOf[id] >= 0) this->children[next[this->managerOf[id]]++] = id;
+        }
+    }
+
+    void buildLevels() {
+        int n = this->employeeName.size();
+        this->levelOrder.clear();
+        this->levelOrder.reserve(n);
+        for(int id = 0; id < n; id++) {
+            if(this->managerOf[id] < 0) this->levelOrder.push_back(id);
+        }
+        this->levelStart = {0};
+        size_t head = 0;
+        while(head < this->levelOrder.size()) {
+            size_t levelEnd = this->levelOrder.size();
+            this->levelStart.push_back(levelEnd);
+            for(; head < levelEnd; head++) {
+                int id = this->levelOrder[head];
+                for(int c = this->childStart[id]; c < this->childStart[id + 1]; c++) {
+                    this->levelOrder.push_back(this->children[c]);
+                }
+            }
+        }
+        if((int)this->levelOrder.size() != n) {
+            throw invalid_argument("Org chart contains a reporting cycle");
+        }
+    }
+
+    // Pull-based: each employee sums its own reportees, which sit one level deeper and
+    // are already final, so threads working on one level never write the same slot
+    void computeCounts(int threadCount) {
+        this->count.assign(this->employeeName.size(), 0);
+        for(int depth = (int)this->levelStart.size() - 2; depth >= 0; depth--) {
+            int from = this->levelStart[depth], to = this->levelStart[depth + 1];
+            auto work = [&](int begin, int end) {
+                for(int i = begin; i < end; i++) {
+                    int id = this->levelOrder[i], total = 0;
+                    for(int c = this->childStart[id]; c < this->childStart[id + 1]; c++) {
+                        total += this->count[this->children[c]] + 1;
+                    }
+                    this->count[id] = total;
+                }
+            };
+            int workers = min(threadCount, (to - from) / 4096); // Small levels are not worth a thread
+            if(workers <= 1) {
+                work(from, to);
+                continue;
+            }
+            vector<thread> threads;
+            int chunk = (to - from + workers - 1) / workers;
+            for(int w = 0; w < workers; w++) {
+                threads.emplace_back(work, from + w * chunk, min(to, from + (w + 1) * chunk));
+            }
+            for(thread& t : threads) t.join();
+        }
+    }
+
+  public:
+    OrgChartBulkLoader(const vector<pair<string, string>>& managerReporteePairs, int threadCount = thread::hardware_concurrency()) {
+        this->employeeId.reserve(managerReporteePairs.size() * 2);
+        for(auto& [manager, reportee] : managerReporteePairs) {
+            int managerId = intern(manager);
+            int reporteeId = intern(reportee);
+            if(this->managerOf[reporteeId] >= 0) {
+                throw invalid_argument(reportee + " has more than one manager");
+            }
+            this->managerOf[reporteeId] = managerId;
+        }
+        buildChildArray();
+        buildLevels();
+        computeCounts(max(1, threadCount));
+    }
+
+    int size() const {
+        return this->employeeName.size();
+    }
+
+    const string& name(int id) const {
+        return this->employeeName[id];
+    }
+
+    int managerOfId(int id) const {
+        return this->managerOf[id];
+    }
+
+    int directOrIndirectCount(int id) const {
+        return this->count[id];
+    }
+
+    // Reportees of id in the CSR array
+    pair<const int*, const int*> reportees(int id) const {
+        return {this->children.data() + this->childStart[id], this->children.data() + this->childStart[id + 1]};
+    }
+};
+
+// Same as OrganisationHierrachy.cpp, plus a constructor that takes over a bulk load
+class OrganisationHierrachy {
+  private:
+    unordered_map<string, vector<string>>adjacenyList; // manager -> [reportees]
+    unordered_map<string, string> managerOf; // reportee -> manager
+    unordered_map<string, int> directAndIndirectCount; // manager -> count (direct or indirect count)
+
+    void updateCount(string employee, int sign) {
+        if(managerOf.find(employee) == managerOf.end()) {
+            return;
+        }
+        string manager = managerOf[employee];
+        directAndIndirectCount[manager] += sign;
+        updateCount(manager, sign);
+    }
+
+  public:
+    OrganisationHierrachy() {}
+
+    // Hand-off from the bulk loader: O(n) map inserts, no per-edge chain walks
+    OrganisationHierrachy(const OrgChartBulkLoader& loaded) {
+        int n = loaded.size();
+        this->adjacenyList.reserve(n);
+        this->managerOf.reserve(n);
+        this->directAndIndirectCount.reserve(n);
+        for(int id = 0; id < n; id++) {
+            const string& employee = loaded.name(id);
+            if(loaded.managerOfId(id) >= 0) {
+                this->managerOf[employee] = loaded.name(loaded.managerOfId(id));
+            }
+            auto [first, last] = loaded.reportees(id);
+            if(first != last) {
+                vector<string>& reportees = this->adjacenyList[employee];
+                for(const int* r = first; r != last; r++) reportees.push_back(loaded.name(*r));
+            }
+            if(loaded.directOrIndirectCount(id) > 0) {
+                this->directAndIndirectCount[employee] = loaded.directOrIndirectCount(id);
+            }
+        }
+    }
+
+    void addNewReportee(string manager, string reportee) {
+        this->adjacenyList[manager].push_back(reportee);
+        this->managerOf[reportee] = manager;
+        updateCount(reportee, 1);
+    }
+
+    int directOrIndirectCount(string manager) {
+        return this->directAndIndirectCount[manager];
+    }
+
+    void moveReportee(string reportee, string newManager) {
+
+        updateCount(reportee, -1);
+
+        string currentManager = this->managerOf[reportee];
+        this->managerOf[reportee] = newManager;
+        this->adjacenyList[newManager].push_back(reportee);
+
+        auto it = find(this->adjacenyList[currentManager].begin(), this->adjacenyList[currentManager].end(), reportee);
+        if(it != this->adjacenyList[currentManager].end()) {
+            this->adjacenyList[currentManager].erase(it);
+        }
+        updateCount(reportee, 1);
+    }
+};
+
+// Bulk load vs repeated addNewReportee on a random org where each hire reports to one
+// of the previous `window` hires (chains of depth roughly n / window)
+void benchmark(int n, int window) {
+    mt19937 rng(5);
+    vector<pair<string, string>> pairs;
+    for(int i = 1; i < n; i++) {
+        pairs.push_back({"E" + to_string(max(0, i - 1 - (int)(rng() % window))), "E" + to_string(i)});
+    }
+
+    auto start = chrono::steady_clock::now();
+    OrgChartBulkLoader loader(pairs);
+    OrganisationHierrachy bulk(loader);
+    double bulkMs = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+
+    start = chrono::steady_clock::now();
+    OrganisationHierrachy incremental;
+    for(auto& [manager, reportee] : pairs) incremental.addNewReportee(manager, reportee);
+    double incrementalMs = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+
+    bool same = true;
+    for(int i = 0; i < n; i += 97) {
+        string employee = "E" + to_string(i);
+        same = same && bulk.directOrIndirectCount(employee) == incremental.directOrIndirectCount(employee);
+    }
+    cout<<"Employees: "<<n<<", bulk load: "<<bulkMs<<" ms, repeated addNewReportee: "<<incrementalMs
+        <<" ms, counts match: "<<(same ? "yes" : "no")<<endl;
+}
+
+int main() {
+    vector<pair<string, string>> hrExport = {
+        {"A", "B"}, {"A", "C"}, {"B", "D"}, {"B", "E"}, {"C", "F"}, {"C", "H"}, {"C", "G"}, {"F", "I"}
+    };
+    OrgChartBulkLoader loader(hrExport);
+    OrganisationHierrachy OrganisationHierrachy(loader);
+
+    for(string employee : {"A", "B", "C", "D", "E", "F", "G", "H", "I"}) {
+        cout<<employee<<" -> "<<OrganisationHierrachy.directOrIndirectCount(employee)<<endl;
+    }
+
+    cout<<"Updating the new reportee!!"<<endl;
+
+    OrganisationHierrachy.moveReportee("I", "B");
+    OrganisationHierrachy.addNewReportee("I", "T");
+
+    for(string employee : {"A", "B", "C", "D", "E", "F", "G", "H", "I", "T"}) {
+        cout<<employee<<" -> "<<OrganisationHierrachy.directOrIndirectCount(employee)<<endl;
+    }
+
+    try {
+        OrgChartBulkLoader cyclic({{"X", "Y"}, {"Y", "X"}});
+    } catch(const invalid_argument& e) {
+        cout<<"Rejected: "<<e.what()<<endl;
+    }
+
+    benchmark(1000000, 50000);
+    return 0;
+}
+
+/*
+PROBLEM STATEMENT:
+Same as OrganisationHierrachy.cpp, but the org chart arrives as one HR export of
+(manager, reportee) pairs. Loading it with repeated addNewReportee walks the manager
+chain for every edge, which is O(n * depth).
+
+APPROACH:
+- Intern names to dense ids and record managerOf[id].
+- Counting sort the edges by manager into a CSR child array (childStart, children).
+- One BFS from the roots buckets employees by depth. Anyone not reached sits on a
+  reporting cycle, which is rejected.
+- Walk the depth levels from the deepest up. Every employee of a level computes
+  count = sum(count[reportee] + 1) over its own reportees, which are one level deeper
+  and already final. Large levels are split across threads with no atomics.
+- OrganisationHierrachy(const OrgChartBulkLoader&) fills the incremental class's maps
+  directly, and addNewReportee / moveReportee take over from there.
+
+TIME COMPLEXITY:
+- Bulk load: O(n) work, O(depth) sequential level steps
+- Hand-off: O(n)
+*/
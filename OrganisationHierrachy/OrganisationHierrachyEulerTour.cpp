@@ -0,0 +1,399 @@
+#include<bits/stdc++.h>
+
+using namespace std;
+
+// Euler-tour tree: every employee owns an ENTER and an EXIT token, and the tokens of
+// a whole org form one sequence where an employee's subtree is the contiguous range
+// [ENTER, EXIT]. The sequence is stored in an implicit treap with parent pointers,
+// so a token's position is found by walking up, and moving a subtree is split/merge.
+class OrganisationHierrachyEulerTour {
+  private:
+    unordered_map<string, int> employeeId; // name -> interned id
+    vector<string> employeeName; // id -> name
+    vector<int> managerOf; // id -> manager id (-1 for a root)
+
+    // Treap over tokens; token 2 * id is ENTER(id), 2 * id + 1 is EXIT(id)
+    vector<int> leftChild, rightChild, parent, subtreeSize;
+    vector<uint32_t> priority;
+    mt19937 rng{20240917};
+
+    int size(int t) {
+        return t < 0 ? 0 : this->subtreeSize[t];
+    }
+
+    void pull(int t) {
+        this->subtreeSize[t] = 1 + size(this->leftChild[t]) + size(this->rightChild[t]);
+        if(this->leftChild[t] >= 0) this->parent[this->leftChild[t]] = t;
+        if(this->rightChild[t] >= 0) this->parent[this->rightChild[t]] = t;
+    }
+
+    int merge(int a, int b) {
+        if(a < 0) return b;
+        if(b < 0) return a;
+        if(this->priority[a] > this->priority[b]) {
+            this->rightChild[a] = merge(this->rightChild[a], b);
+            pull(a);
+            return a;
+        }
+        this->leftChild[b] = merge(a, this->leftChild[b]);
+        pull(b);
+        return b;
+    }
+
+    // Splits t into the first k tokens and the rest
+    pair<int, int> split(int t, int k) {
+        if(t < 0) return {-1, -1};
+        if(size(this->leftChild[t]) >= k) {
+            auto [a, b] = split(this->leftChild[t], k);
+            this->leftChild[t] = b;
+            pull(t);
+            if(a >= 0) this->parent[a] = -1;
+            return {a, t};
+        }
+        auto [a, b] = split(this->rightChild[t], k - size(this->leftChild[t]) - 1);
+        this->rightChild[t] = a;
+        pull(t);
+        if(b >= 0) this->parent[b] = -1;
+        return {t, b};
+    }
+
+    int rootOf(int t) {
+        while(this->parent[t] >= 0) t = this->parent[t];
+        return t;
+    }
+
+    int position(int t) {
+        int pos = size(this->leftChild[t]);
+        while(this->parent[t] >= 0) {
+            int p = this->parent[t];
+            if(this->rightChild[p] == t) pos += size(this->leftChild[p]) + 1;
+            t = p;
+        }
+        return pos;
+    }
+
+    int intern(const string& employee) {
+        auto it = this->employeeId.find(employee);
+        if(it != this->employeeId.end()) return it->second;
+
+        int id = this->employeeName.size();
+        this->employeeId.emplace(employee, id);
+        this->employeeName.push_back(employee);
+        this->managerOf.push_back(-1);
+        for(int k = 0; k < 2; k++) {
+            this->leftChild.push_back(-1);
+            this->rightChild.push_back(-1);
+            this->parent.push_back(-1);
+            this->subtreeSize.push_back(1);
+            this->priority.push_back(this->rng());
+        }
+        merge(2 * id, 2 * id + 1); // A new employee is a tour of its own: ENTER EXIT
+        return id;
+    }
+
+    // Inserts the tour rooted at token `tour` right after ENTER(manager)
+    void attach(int tour, int manager) {
+        int root = rootOf(2 * manager);
+        auto [before, after] = split(root, position(2 * manager) + 1);
+        merge(merge(before, tour), after);
+    }
+
+    // Cuts the subtree of `employee` out of its tour and returns it as its own treap
+    int detach(int employee) {
+        int root = rootOf(2 * employee);
+        int from = position(2 * employee), to = position(2 * employee + 1);
+        auto [before, rest] = split(root, from);
+        auto [subtree, after] = split(rest, to - from + 1);
+        merge(before, after);
+        return subtree;
+    }
+
+  public:
+    OrganisationHierrachyEulerTour() {}
+
+    int getId(const string& employee) {
+        return intern(employee);
+    }
+
+    // True when `employee` is `manager` or reports to them directly or indirectly
+    bool isInOrg(int employee, int manager) {
+        if(rootOf(2 * employee) != rootOf(2 * manager)) return false;
+        int pos = position(2 * employee);
+        return position(2 * manager) <= pos && pos <= position(2 * manager + 1);
+    }
+
+    void addNewReportee(int manager, int reportee) {
+        if(this->managerOf[reportee] >= 0) {
+            moveReportee(reportee, manager);
+            return;
+        }
+        if(isInOrg(manager, reportee)) {
+            throw invalid_argument("Adding " + this->employeeName[reportee] + " under " + this->employeeName[manager] + " would create a cycle");
+        }
+        this->managerOf[reportee] = manager;
+        attach(detach(reportee), manager);
+    }
+
+    void addNewReportee(const string& manager, const string& reportee) {
+        int managerId = intern(manager);
+        addNewReportee(managerId, intern(reportee));
+    }
+
+    // O(log n) expected: the subtree spans (EXIT - ENTER + 1) tokens, two per employee
+    int directOrIndirectCount(int manager) {
+        return (position(2 * manager + 1) - position(2 * manager) + 1) / 2 - 1;
+    }
+
+    int directOrIndirectCount(const string& manager) {
+        auto it = this->employeeId.find(manager);
+        return it == this->employeeId.end() ? 0 : directOrIndirectCount(it->second);
+    }
+
+    // O(log n) expected: one detach and one attach of the reportee's tour range
+    void moveReportee(int reportee, int newManager) {
+        if(isInOrg(newManager, reportee)) {
+            throw invalid_argument("Moving " + this->employeeName[reportee] + " under " + this->employeeName[newManager] + " would create a cycle");
+        }
+        this->managerOf[reportee] = newManager;
+        attach(detach(reportee), newManager);
+    }
+
+    void moveReportee(const string& reportee, const string& newManager) {
+        int reporteeId = intern(reportee);
+        moveReportee(reporteeId, intern(newManager));
+    }
+};
+
+// Same as OrganisationHierrachy.cpp, kept here as the benchmark baseline
+class OrganisationHierrachy {
+  private:
+    unordered_map<string, vector<string>>adjacenyList; // manager -> [reportees]
+    unordered_map<string, string> managerOf; // reportee -> manager
+    unordered_map<string, int> directAndIndirectCount; // manager -> count (direct or indirect count)
+
+    void updateCount(string employee, int sign) {
+        if(managerOf.find(employee) == managerOf.end()) {
+            return;
+        }
+        string manager = managerOf[employee];
+        directAndIndirectCount[manager] += sign;
+        updateCount(manager, sign);
+    }
+
+  public:
+    void addNewReportee(string manager, string reportee) {
+        this->adjacenyList[manager].push_back(reportee);
+        this->managerOf[reportee] = manager;
+        updateCount(reportee, 1);
+    }
+
+    int directOrIndirectCount(string manager) {
+        return this->directAndIndirectCount[manager];
+    }
+
+    void moveReportee(string reportee, string newManager) {
+        updateCount(reportee, -1);
+        string currentManager = this->managerOf[reportee];
+        this->managerOf[reportee] = newManager;
+        this->adjacenyList[newManager].push_back(reportee);
+        auto it = find(this->adjacenyList[currentManager].begin(), this->adjacenyList[currentManager].end(), reportee);
+        if(it != this->adjacenyList[currentManager].end()) {
+            this->adjacenyList[currentManager].erase(it);
+        }
+        updateCount(reportee, 1);
+    }
+};
+
+// Same as OrganisationHierrachyBruteForce.cpp, kept here as the benchmark baseline
+class OrganisationHierrachyBruteForce {
+  private:
+    unordered_map<string, vector<string>>adjacenyList; // manager -> reportees
+    unordered_map<string, string> managerOf; // employee -> manger
+
+    void dfs(string employee, int& count) {
+        for(string reportee : adjacenyList[employee]) {
+            count++;
+            dfs(reportee, count);
+        }
+    }
+
+  public:
+    void addNewReportee(string manager, string reportee) {
+        this->adjacenyList[manager].push_back(reportee);
+        this->managerOf[reportee] = manager;
+    }
+
+    int countDirectAndIndirectReportee(string manager) {
+        int count = 0;
+        dfs(manager, count);
+        return count;
+    }
+
+    void moveReportee(string reportee, string newManager) {
+        string currentManager = this->managerOf[reportee];
+        this->managerOf[reportee] = newManager;
+        this->adjacenyList[newManager].push_back(reportee);
+        auto it = find(this->adjacenyList[currentManager].begin(), this->adjacenyList[currentManager].end(), reportee);
+        if(it != this->adjacenyList[currentManager].end()) {
+            this->adjacenyList[currentManager].erase(it);
+        }
+    }
+};
+
+// Random org of n employees: each new hire reports to one of the previous `window`
+// hires, which gives chains of depth roughly n / window.
+// Note: OrganisationHierrachy::moveReportee only shifts the ancestors' counts by one,
+// so its checksum drifts from the other two once moved reportees have reportees.
+//
+// The Incremental baseline walks the whole chain on every add, so building it is
+// O(n * depth). When incrementalMsPerPair is given, its build is only time-boxed to
+// show how far it gets, and its move+count time is extrapolated from that per-pair
+// cost (measured on a smaller org with the same chain depth).
+// Returns the Incremental ms per move+count pair.
+double benchmark(int n, int window, int operations, bool runBruteForce, double incrementalMsPerPair = 0) {
+    mt19937 rng(7);
+    vector<pair<int, int>> edges;
+    for(int i = 1; i < n; i++) {
+        edges.push_back({max(0, i - 1 - (int)(rng() % window)), i});
+    }
+
+    // The planner picks valid moves (new manager outside the reportee's org) up front,
+    // so all three engines replay exactly the same workload
+    OrganisationHierrachyEulerTour planner, eulerTour;
+    OrganisationHierrachy incremental;
+    OrganisationHierrachyBruteForce bruteForce;
+    auto name = [](int id) { return "E" + to_string(id); };
+    bool runIncremental = incrementalMsPerPair == 0;
+    for(auto& [manager, reportee] : edges) {
+        planner.addNewReportee(name(manager), name(reportee));
+        eulerTour.addNewReportee(name(manager), name(reportee));
+        if(runIncremental) incremental.addNewReportee(name(manager), name(reportee));
+        if(runBruteForce) bruteForce.addNewReportee(name(manager), name(reportee));
+    }
+
+    vector<pair<int, int>> moves;
+    vector<int> queries;
+    for(int i = 0; i < operations; i++) {
+        int reportee = 1 + rng() % (n - 1), newManager = rng() % n;
+        if(!planner.isInOrg(newManager, reportee)) {
+            moves.push_back({reportee, newManager});
+            planner.moveReportee(reportee, newManager);
+            queries.push_back(rng() % n);
+        }
+    }
+
+    auto timeIt = [&](auto&& body) {
+        auto start = chrono::steady_clock::now();
+        long long checksum = body();
+        double ms = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+        return make_pair(ms, checksum);
+    };
+
+    auto eulerResult = timeIt([&]() {
+        long long checksum = 0;
+        for(size_t i = 0; i < moves.size(); i++) {
+            eulerTour.moveReportee(name(moves[i].first), name(moves[i].second));
+            checksum += eulerTour.directOrIndirectCount(name(queries[i]));
+        }
+        return checksum;
+    });
+    auto incrementalResult = timeIt([&]() {
+        long long checksum = 0;
+        for(size_t i = 0; runIncremental && i < moves.size(); i++) {
+            incremental.moveReportee(name(moves[i].first), name(moves[i].second));
+            checksum += incremental.directOrIndirectCount(name(queries[i]));
+        }
+        return checksum;
+    });
+    auto bruteForceResult = timeIt([&]() {
+        long long checksum = 0;
+        for(size_t i = 0; runBruteForce && i < moves.size(); i++) {
+            bruteForce.moveReportee(name(moves[i].first), name(moves[i].second));
+            checksum += bruteForce.countDirectAndIndirectReportee(name(queries[i]));
+        }
+        return checksum;
+    });
+
+    cout<<"Employees: "<<n<<", move+count pairs: "<<moves.size()<<endl;
+    cout<<"  EulerTour:   "<<eulerResult.first<<" ms (checksum "<<eulerResult.second<<")"<<endl;
+    if(runIncremental) {
+        cout<<"  Incremental: "<<incrementalResult.first<<" ms (checksum "<<incrementalResult.second<<")"<<endl;
+    } else {
+        const double budgetMs = 10000;
+        OrganisationHierrachy partial;
+        auto start = chrono::steady_clock::now();
+        size_t added = 0;
+        for(; added < edges.size() && chrono::duration<double, milli>(chrono::steady_clock::now() - start).count() < budgetMs; added++) {
+            partial.addNewReportee(name(edges[added].first), name(edges[added].second));
+        }
+        cout<<"  Incremental: ~"<<incrementalMsPerPair * moves.size()<<" ms (extrapolated from the per-pair cost at the same chain depth)"<<endl;
+        cout<<"               not run: its build added only "<<added<<" of "<<edges.size()<<" employees in a "
+            <<budgetMs / 1000<<" s time box"<<endl;
+    }
+    if(runBruteForce) {
+        cout<<"  BruteForce:  "<<bruteForceResult.first<<" ms (checksum "<<bruteForceResult.second<<")"<<endl;
+    }
+    return moves.empty() ? 0 : incrementalResult.first / moves.size();
+}
+
+int main() {
+    OrganisationHierrachyEulerTour OrganisationHierrachy;
+    OrganisationHierrachy.addNewReportee("A", "B");
+    OrganisationHierrachy.addNewReportee("A", "C");
+    OrganisationHierrachy.addNewReportee("B", "D");
+    OrganisationHierrachy.addNewReportee("B", "E");
+    OrganisationHierrachy.addNewReportee("C", "F");
+    OrganisationHierrachy.addNewReportee("C", "H");
+    OrganisationHierrachy.addNewReportee("C", "G");
+    OrganisationHierrachy.addNewReportee("F", "I");
+
+    for(string employee : {"A", "B", "C", "D", "E", "F", "G", "H", "I"}) {
+        cout<<employee<<" -> "<<OrganisationHierrachy.directOrIndirectCount(employee)<<endl;
+    }
+
+    cout<<"Updating the new reportee!!"<<endl;
+
+    OrganisationHierrachy.moveReportee("I", "B");
+    OrganisationHierrachy.addNewReportee("I", "T");
+
+    for(string employee : {"A", "B", "C", "D", "E", "F", "G", "H", "I", "T"}) {
+        cout<<employee<<" -> "<<OrganisationHierrachy.directOrIndirectCount(employee)<<endl;
+    }
+
+    try {
+        OrganisationHierrachy.moveReportee("B", "T");
+    } catch(const invalid_argument& e) {
+        cout<<"Rejected: "<<e.what()<<endl;
+    }
+
+    benchmark(20000, 20, 20000, true);
+    // Same chain depth (~1000) as the 1M-employee org below
+    double incrementalMsPerPair = benchmark(100000, 100, 50000, false);
+    benchmark(1000000, 1000, 200000, false, incrementalMsPerPair);
+    return 0;
+}
+
+/*
+PROBLEM STATEMENT:
+Same as OrganisationHierrachy.cpp, for a 1M-employee org with deep chains.
+
+OrganisationHierrachy.cpp walks the whole manager chain on every add/move (passing
+strings by value at every level) and moveReportee does a linear find in the old
+manager's reportee vector, so a move costs O(depth + fan-out).
+
+APPROACH (Euler-tour tree):
+- Employee names are interned to dense ids once at the API boundary.
+- Each employee has an ENTER and an EXIT token. A DFS of an org writes
+  ENTER(x) ... tokens of x's reportees ... EXIT(x), so x's org is the
+  contiguous range [ENTER(x), EXIT(x)].
+- The token sequence lives in an implicit treap with parent pointers.
+  position(token) walks up the treap in O(log n) expected.
+- directOrIndirectCount(x) = (pos(EXIT x) - pos(ENTER x) + 1) / 2 - 1
+- moveReportee(r, m): split out [ENTER r, EXIT r], merge the rest back, then
+  split m's tour right after ENTER(m) and merge r's range in between.
+- A move under one's own org is rejected (it would create a cycle).
+
+TIME COMPLEXITY:
+- addNewReportee / moveReportee: O(log n) expected
+- directOrIndirectCount: O(log n) expected
+*/
@@ -0,0 +1,583 @@
+/**
+ * Parking Lot Management System - Bitmap Spot Allocator
+ *
+ * Same parking rules as ParkingLot.cpp, but spots and vehicles are addressed
+ * by dense integer handles. Free spots are tracked with one free-bitmap per
+ * (level, SpotType) and allocation is a find-first-set over that bitmap.
+ * Strings (spotId / vehicleId) only appear at the API boundary.
+ *
+ * Rules: Motorcycles can park anywhere, Cars need car spots only
+ */
+
+#include <bits/stdc++.h>
+using namespace std;
+
+enum class VehicleType { MOTORCYCLE, CAR };
+enum class SpotType { MOTORCYCLE, CAR };
+
+static constexpr int SPOT_TYPE_COUNT = 2;
+
+using SpotHandle = uint32_t;     // Dense index into the allocator's spot arrays
+using VehicleHandle = uint32_t;  // Dense index into the allocator's vehicle arrays
+static constexpr uint32_t NO_HANDLE = numeric_limits<uint32_t>::max();
+
+/**
+ * FreeBitmap tracks which slots of a (level, SpotType) bucket are free
+ * Bit i of words is set when slot i is free; bit w of summary is set when
+ * words[w] has at least one free slot, so findFirstFree() touches two words
+ * in the common case instead of scanning the whole bitmap.
+ */
+class FreeBitmap {
+private:
+    vector<uint64_t> words;      // slot-level free bits
+    vector<uint64_t> summary;    // word-level "has a free slot" bits
+    uint32_t slotCount = 0;      // Number of slots ever added
+    uint32_t freeCount = 0;      // Number of currently free slots
+    mutable size_t summaryHint = 0;  // No summary word below this index is non-zero
+
+public:
+    /**
+     * Append a new slot and mark it free
+     * @return Index of the new slot
+     */
+    uint32_t addSlot() {
+        uint32_t slot = slotCount++;
+        if ((slot >> 6) >= words.size()) {
+            words.push_back(0);
+            if (((words.size() - 1) >> 6) >= summary.size()) {
+                summary.push_back(0);
+            }
+        }
+        markFree(slot);
+        return slot;
+    }
+
+    void markFree(uint32_t slot) {
+        size_t w = slot >> 6;
+        words[w] |= (1ULL << (slot & 63));
+        summary[w >> 6] |= (1ULL << (w & 63));
+        summaryHint = min(summaryHint, w >> 6);
+        freeCount++;
+    }
+
+    void markUsed(uint32_t slot) {
+        size_t w = slot >> 6;
+        words[w] &= ~(1ULL << (slot & 63));
+        if (words[w] == 0) {
+            summary[w >> 6] &= ~(1ULL << (w & 63));
+        }
+        freeCount--;
+    }
+
+    bool isFree(uint32_t slot) const {
+        return (words[slot >> 6] >> (slot & 63)) & 1ULL;
+    }
+
+    /**
+     * Find the lowest free slot using find-first-set on both bitmap levels
+     * @return Slot index, or NO_HANDLE if every slot is in use
+     */
+    uint32_t findFirstFree() const {
+        if (freeCount == 0) {
+            return NO_HANDLE;
+        }
+        while (summary[summaryHint] == 0) {
+            summaryHint++;
+        }
+        size_t w = (summaryHint << 6) + __builtin_ctzll(summary[summaryHint]);
+        return static_cast<uint32_t>((w << 6) + __builtin_ctzll(words[w]));
+    }
+
+    uint32_t getFreeCount() const { return freeCount; }
+    uint32_t getSlotCount() const { return slotCount; }
+};
+
+/**
+ * SpotAllocator is the integer-only core of the parking lot
+ * Every spot gets a SpotHandle and every vehicle a VehicleHandle; all
+ * per-spot and per-vehicle state lives in parallel arrays indexed by handle.
+ *
+ * Time Complexity:
+ * - park: O(1) expected (find-first-set over level bitmap + bucket bitmap)
+ * - unpark: O(1)
+ * - getVehicleInSpot: O(1) array index
+ */
+class SpotAllocator {
+private:
+    struct Bucket {
+        FreeBitmap freeSlots;             // Free spots of one type on one level
+        vector<SpotHandle> slotToSpot;    // Bucket slot -> global spot handle
+    };
+
+    // Per (level, SpotType) buckets, indexed level * SPOT_TYPE_COUNT + type
+    vector<Bucket> buckets;
+    // Per SpotType: bit L set when level L has a free spot of that type
+    FreeBitmap levelsWithFree[SPOT_TYPE_COUNT];
+    int levelCount = 0;
+
+    // Per-spot state, indexed by SpotHandle
+    vector<uint32_t> spotLevel;
+    vector<SpotType> spotType;
+    vector<uint32_t> spotSlot;
+    vector<VehicleHandle> spotOccupant;
+
+    // Per-vehicle state, indexed by VehicleHandle
+    vector<VehicleType> vehicleType;
+    vector<SpotHandle> vehicleSpot;
+    vector<VehicleHandle> releasedVehicles;  // Handles free for addVehicle to reuse
+
+    Bucket& bucketFor(uint32_t level, SpotType type) {
+        return buckets[level * SPOT_TYPE_COUNT + static_cast<int>(type)];
+    }
+
+    SpotHandle claimFromLevel(uint32_t level, SpotType type) {
+        Bucket& bucket = bucketFor(level, type);
+        uint32_t slot = bucket.freeSlots.findFirstFree();
+        bucket.freeSlots.markUsed(slot);
+        if (bucket.freeSlots.getFreeCount() == 0) {
+            levelsWithFree[static_cast<int>(type)].markUsed(level);
+        }
+        return bucket.slotToSpot[slot];
+    }
+
+public:
+    /**
+     * Add a new level
+     * @return Dense level index (0, 1, 2, ...)
+     */
+    uint32_t addLevel() {
+        for (int t = 0; t < SPOT_TYPE_COUNT; t++) {
+            buckets.emplace_back();
+            levelsWithFree[t].addSlot();
+            levelsWithFree[t].markUsed(levelCount);  // Empty until a spot is added
+        }
+        return levelCount++;
+    }
+
+    /**
+     * Add a spot of the given type to a level
+     * @throws invalid_argument if the level index is unknown
+     * @return Handle of the new spot
+     */
+    SpotHandle addSpot(uint32_t level, SpotType type) {
+        if (level >= static_cast<uint32_t>(levelCount)) {
+            throw invalid_argument("Unknown level index " + to_string(level));
+        }
+        SpotHandle spot = static_cast<SpotHandle>(spotLevel.size());
+        Bucket& bucket = bucketFor(level, type);
+        bool wasFull = bucket.freeSlots.getFreeCount() == 0;
+        uint32_t slot = bucket.freeSlots.addSlot();
+        bucket.slotToSpot.push_back(spot);
+        if (wasFull) {
+            levelsWithFree[static_cast<int>(type)].markFree(level);
+        }
+
+        spotLevel.push_back(level);
+        spotType.push_back(type);
+        spotSlot.push_back(slot);
+        spotOccupant.push_back(NO_HANDLE);
+        return spot;
+    }
+
+    /**
+     * Register a vehicle so it can be parked by handle
+     * Reuses a handle given up by removeVehicle before growing the arrays
+     * @return Handle of the new vehicle
+     */
+    VehicleHandle addVehicle(VehicleType type) {
+        if (!releasedVehicles.empty()) {
+            VehicleHandle vehicle = releasedVehicles.back();
+            releasedVehicles.pop_back();
+            vehicleType[vehicle] = type;
+            return vehicle;
+        }
+        vehicleType.push_back(type);
+        vehicleSpot.push_back(NO_HANDLE);
+        return static_cast<VehicleHandle>(vehicleType.size() - 1);
+    }
+
+    /**
+     * Give up a vehicle handle; a later addVehicle may hand it out again
+     * @throws runtime_error if the vehicle is still parked
+     */
+    void removeVehicle(VehicleHandle vehicle) {
+        if (vehicleSpot[vehicle] != NO_HANDLE) {
+            throw runtime_error("Vehicle handle " + to_string(vehicle) + " is still parked");
+        }
+        releasedVehicles.push_back(vehicle);
+    }
+
+    /**
+     * Park a vehicle in the first level that can take it
+     * Within a level, motorcycles prefer motorcycle spots over car spots,
+     * matching ParkingLevel::findAvailableSpotId in ParkingLot.cpp
+     * @return Handle of the claimed spot, or NO_HANDLE if the lot is full
+     * @throws runtime_error if the vehicle is already parked
+     */
+    SpotHandle park(VehicleHandle vehicle) {
+        if (vehicleSpot[vehicle] != NO_HANDLE) {
+            throw runtime_error("Vehicle handle " + to_string(vehicle) + " is already parked");
+        }
+
+        uint32_t carLevel = levelsWithFree[static_cast<int>(SpotType::CAR)].findFirstFree();
+        SpotHandle spot = NO_HANDLE;
+        switch (vehicleType[vehicle]) {
+            case VehicleType::MOTORCYCLE: {
+                uint32_t motoLevel = levelsWithFree[static_cast<int>(SpotType::MOTORCYCLE)].findFirstFree();
+                if (motoLevel != NO_HANDLE && motoLevel <= carLevel) {
+                    spot = claimFromLevel(motoLevel, SpotType::MOTORCYCLE);
+                } else if (carLevel != NO_HANDLE) {
+                    spot = claimFromLevel(carLevel, SpotType::CAR);
+                }
+                break;
+            }
+            case VehicleType::CAR:
+                if (carLevel != NO_HANDLE) {
+                    spot = claimFromLevel(carLevel, SpotType::CAR);
+                }
+                break;
+            default:
+                // Unknown vehicle type - extensible for future vehicle types
+                break;
+        }
+
+        if (spot != NO_HANDLE) {
+            spotOccupant[spot] = vehicle;
+            vehicleSpot[vehicle] = spot;
+        }
+        return spot;
+    }
+
+    /**
+     * Unpark a vehicle and return its spot to the free-bitmap
+     * @throws runtime_error if the vehicle is not parked
+     */
+    void unpark(VehicleHandle vehicle) {
+        SpotHandle spot = vehicleSpot[vehicle];
+        if (spot == NO_HANDLE) {
+            throw runtime_error("Vehicle handle " + to_string(vehicle) + " is not parked");
+        }
+        uint32_t level = spotLevel[spot];
+        SpotType type = spotType[spot];
+        Bucket& bucket = bucketFor(level, type);
+        if (bucket.freeSlots.getFreeCount() == 0) {
+            levelsWithFree[static_cast<int>(type)].markFree(level);
+        }
+        bucket.freeSlots.markFree(spotSlot[spot]);
+        spotOccupant[spot] = NO_HANDLE;
+        vehicleSpot[vehicle] = NO_HANDLE;
+    }
+
+    VehicleHandle getVehicleInSpot(SpotHandle spot) const { return spotOccupant[spot]; }
+    SpotHandle getSpotOfVehicle(VehicleHandle vehicle) const { return vehicleSpot[vehicle]; }
+    uint32_t getSpotLevel(SpotHandle spot) const { return spotLevel[spot]; }
+    size_t getSpotCount() const { return spotLevel.size(); }
+    int getLevelCount() const { return levelCount; }
+
+    uint32_t getFreeCount(uint32_t level, SpotType type) const {
+        return buckets[level * SPOT_TYPE_COUNT + static_cast<int>(type)].freeSlots.getFreeCount();
+    }
+};
+
+/**
+ * ParkingLot is the string-facing API on top of SpotAllocator
+ * Spot and vehicle IDs are interned to handles once; park/unpark/lookups
+ * then run entirely on integer handles. A vehicle ID holds its handle only
+ * while parked: unpark releases it for reuse, so a returning vehicle may
+ * come back with a different type. Callers that already hold handles can
+ * use allocator() directly and skip the string maps altogether.
+ */
+class ParkingLot {
+private:
+    SpotAllocator spotAllocator;
+    unordered_map<int, uint32_t> levelNumberToIndex;         // levelNumber -> dense level index
+    vector<int> levelNumbers;                                // dense level index -> levelNumber
+    unordered_map<string, SpotHandle> spotIdToHandle;        // spotId -> handle (boundary only)
+    vector<string> spotIds;                                  // handle -> spotId
+    unordered_map<string, VehicleHandle> vehicleIdToHandle;  // vehicleId -> handle (boundary only)
+    vector<string> vehicleIds;                               // handle -> vehicleId
+
+public:
+    /**
+     * Add a level to the parking lot
+     * @throws invalid_argument if levelNumber is less than 1
+     * @throws runtime_error if level number already exists
+     */
+    void addLevel(int levelNumber) {
+        if (levelNumber < 1) {
+            throw invalid_argument("Level number must be at least 1");
+        }
+        if (levelNumberToIndex.count(levelNumber)) {
+            throw runtime_error("Level " + to_string(levelNumber) + " already exists");
+        }
+        levelNumberToIndex[levelNumber] = spotAllocator.addLevel();
+        levelNumbers.push_back(levelNumber);
+    }
+
+    /**
+     * Add a spot to an existing level
+     * Duplicate detection is a single hash lookup instead of a scan of the level
+     * @throws invalid_argument if spotId is empty
+     * @throws runtime_error if level is unknown or spotId already exists
+     */
+    SpotHandle addSpot(int levelNumber, const string& spotId, SpotType type) {
+        if (spotId.empty()) {
+            throw invalid_argument("Spot ID cannot be empty");
+        }
+        auto levelIt = levelNumberToIndex.find(levelNumber);
+        if (levelIt == levelNumberToIndex.end()) {
+            throw runtime_error("Level " + to_string(levelNumber) + " does not exist");
+        }
+        if (spotIdToHandle.count(spotId)) {
+            throw runtime_error("Spot ID " + spotId + " already exists");
+        }
+        SpotHandle spot = spotAllocator.addSpot(levelIt->second, type);
+        spotIdToHandle[spotId] = spot;
+        spotIds.push_back(spotId);
+        return spot;
+    }
+
+    /**
+     * Park a vehicle by ID
+     * @return spotId of the claimed spot, empty string if the lot is full
+     * @throws invalid_argument if vehicleId is empty
+     * @throws runtime_error if vehicle is already parked
+     */
+    string parkVehicle(const string& vehicleId, VehicleType type) {
+        if (vehicleId.empty()) {
+            throw invalid_argument("Vehicle ID cannot be empty");
+        }
+        if (vehicleIdToHandle.count(vehicleId)) {
+            throw runtime_error("Vehicle " + vehicleId + " is already parked");
+        }
+        VehicleHandle vehicle = spotAllocator.addVehicle(type);
+        SpotHandle spot = spotAllocator.park(vehicle);
+        if (spot == NO_HANDLE) {
+            spotAllocator.removeVehicle(vehicle);
+            return "";
+        }
+        vehicleIdToHandle[vehicleId] = vehicle;
+        if (vehicle == vehicleIds.size()) {
+            vehicleIds.push_back(vehicleId);
+        } else {
+            vehicleIds[vehicle] = vehicleId;
+        }
+        return spotIds[spot];
+    }
+
+    /**
+     * Unpark a vehicle by ID and release its handle
+     * @throws invalid_argument if vehicleId is empty
+     * @throws runtime_error if vehicle is not parked
+     */
+    bool unparkVehicle(const string& vehicleId) {
+        if (vehicleId.empty()) {
+            throw invalid_argument("Vehicle ID cannot be empty");
+        }
+        auto it = vehicleIdToHandle.find(vehicleId);
+        if (it == vehicleIdToHandle.end()) {
+            throw runtime_error("Vehicle " + vehicleId + " is not parked in this lot");
+        }
+        spotAllocator.unpark(it->second);
+        spotAllocator.removeVehicle(it->second);
+        vehicleIdToHandle.erase(it);
+        return true;
+    }
+
+    /**
+     * Get the vehicle parked in a spot
+     * @return vehicleId, empty string if the spot is free
+     * @throws invalid_argument if spotId is empty
+     * @throws runtime_error if spot doesn't exist
+     */
+    string getVehicleInSpot(const string& spotId) {
+        if (spotId.empty()) {
+            throw invalid_argument("Spot ID cannot be empty");
+        }
+        auto it = spotIdToHandle.find(spotId);
+        if (it == spotIdToHandle.end()) {
+            throw runtime_error("Spot " + spotId + " does not exist");
+        }
+        VehicleHandle vehicle = spotAllocator.getVehicleInSpot(it->second);
+        return vehicle == NO_HANDLE ? "" : vehicleIds[vehicle];
+    }
+
+    SpotAllocator& allocator() { return spotAllocator; }
+
+    void printStatus() {
+        cout << "\n=== Parking Lot Status ===" << endl;
+        for (int i = 0; i < spotAllocator.getLevelCount(); i++) {
+            cout << "Level " << levelNumbers[i] << ":" << endl;
+            cout << "  Available motorcycle spots: " << spotAllocator.getFreeCount(i, SpotType::MOTORCYCLE) << endl;
+            cout << "  Available car spots: " << spotAllocator.getFreeCount(i, SpotType::CAR) << endl;
+        }
+        cout << "========================\n" << endl;
+    }
+};
+
+namespace UnitTests {
+    void check(bool condition, const string& message) {
+        cout << (condition ? "✓ " : "✗ ") << message << endl;
+    }
+
+    void testFreeBitmap() {
+        cout << "\n=== Testing FreeBitmap ===" << endl;
+        FreeBitmap bitmap;
+        for (int i = 0; i < 5000; i++) bitmap.addSlot();
+        check(bitmap.findFirstFree() == 0, "First free slot of a fresh bitmap is 0");
+        for (uint32_t i = 0; i < 4500; i++) bitmap.markUsed(i);
+        check(bitmap.findFirstFree() == 4500, "Find-first-set skips fully used words");
+        bitmap.markFree(70);
+        check(bitmap.findFirstFree() == 70, "Freed slot below the hint is found again");
+        check(bitmap.getFreeCount() == 501, "Free count tracks markUsed/markFree");
+    }
+
+    void testParkingRules() {
+        cout << "\n=== Testing Parking Rules ===" << endl;
+        ParkingLot lot;
+        lot.addLevel(1);
+        lot.addLevel(2);
+        lot.addSpot(1, "L1-M1", SpotType::MOTORCYCLE);
+        lot.addSpot(1, "L1-C1", SpotType::CAR);
+        lot.addSpot(2, "L2-C1", SpotType::CAR);
+
+        check(lot.parkVehicle("C001", VehicleType::CAR) == "L1-C1", "Car takes first car spot on level 1");
+        check(lot.parkVehicle("M001", VehicleType::MOTORCYCLE) == "L1-M1", "Motorcycle prefers motorcycle spot");
+        check(lot.parkVehicle("M002", VehicleType::MOTORCYCLE) == "L2-C1", "Motorcycle falls back to car spot");
+        check(lot.parkVehicle("C002", VehicleType::CAR) == "", "Car is rejected when no car spot is free");
+        check(lot.getVehicleInSpot("L2-C1") == "M002", "Lookup by spotId returns the parked vehicle");
+
+        lot.unparkVehicle("C001");
+        check(lot.getVehicleInSpot("L1-C1") == "", "Unparked spot is empty");
+        check(lot.parkVehicle("C002", VehicleType::CAR) == "L1-C1", "Freed spot is reused");
+
+        lot.unparkVehicle("M001");
+        check(lot.parkVehicle("M001", VehicleType::CAR) == "", "Returning vehicle is parked with its new type");
+        check(lot.getVehicleInSpot("L1-M1") == "", "Rejected vehicle leaves no spot claimed");
+        check(lot.parkVehicle("M003", VehicleType::MOTORCYCLE) == "L1-M1", "Released handles are reused");
+        check(lot.allocator().getVehicleInSpot(0) == 1 && lot.getVehicleInSpot("L1-M1") == "M003",
+              "Reused handle maps back to the new vehicle ID");
+
+        try {
+            lot.parkVehicle("C002", VehicleType::CAR);
+            check(false, "Should have thrown exception for already parked vehicle");
+        } catch (const runtime_error& e) {
+            check(true, string("Correctly caught exception for already parked vehicle: ") + e.what());
+        }
+        try {
+            lot.addSpot(2, "L1-M1", SpotType::CAR);
+            check(false, "Should have thrown exception for duplicate spot ID");
+        } catch (const runtime_error& e) {
+            check(true, string("Correctly caught exception for duplicate spot ID: ") + e.what());
+        }
+        try {
+            lot.unparkVehicle("NONEXISTENT");
+            check(false, "Should have thrown exception for non-existent vehicle");
+        } catch (const runtime_error& e) {
+            check(true, string("Correctly caught exception for non-existent vehicle: ") + e.what());
+        }
+    }
+
+    void runAllTests() {
+        testFreeBitmap();
+        testParkingRules();
+    }
+}
+
+namespace Benchmark {
+    /**
+     * Park/unpark throughput on the handle API
+     * Fills the lot to ~half, then alternates unpark of a random parked
+     * vehicle with park of a new one so the bitmaps stay fragmented.
+     */
+    void runParkUnpark(int levels, int spotsPerLevel, int operations) {
+        SpotAllocator allocator;
+        for (int l = 0; l < levels; l++) {
+            uint32_t level = allocator.addLevel();
+            for (int s = 0; s < spotsPerLevel; s++) {
+                allocator.addSpot(level, s % 4 == 0 ? SpotType::MOTORCYCLE : SpotType::CAR);
+            }
+        }
+        int total = levels * spotsPerLevel;
+        vector<VehicleHandle> parked;
+        for (int i = 0; i < total / 2; i++) {
+            VehicleHandle v = allocator.addVehicle(i % 4 == 0 ? VehicleType::MOTORCYCLE : VehicleType::CAR);
+            allocator.park(v);
+            parked.push_back(v);
+        }
+        vector<VehicleHandle> idle;
+        for (int i = 0; i < total / 2; i++) {
+            idle.push_back(allocator.addVehicle(i % 4 == 0 ? VehicleType::MOTORCYCLE : VehicleType::CAR));
+        }
+
+        mt19937 rng(42);
+        auto start = chrono::steady_clock::now();
+        for (int i = 0; i < operations; i++) {
+            size_t idx = rng() % parked.size();
+            allocator.unpark(parked[idx]);
+            swap(parked[idx], idle[i % idle.size()]);
+            allocator.park(parked[idx]);
+        }
+        auto elapsed = chrono::duration<double, nano>(chrono::steady_clock::now() - start).count();
+        cout << "Spots: " << total << ", unpark+park pairs: " << operations
+             << ", avg ns per pair: " << elapsed / operations << endl;
+    }
+}
+
+int main() {
+    UnitTests::runAllTests();
+
+    cout << "\n=== Main Demo ===" << endl;
+    ParkingLot parkingLot;
+    parkingLot.addLevel(1);
+    parkingLot.addSpot(1, "L1-M1", SpotType::MOTORCYCLE);
+    parkingLot.addSpot(1, "L1-M2", SpotType::MOTORCYCLE);
+    parkingLot.addSpot(1, "L1-C1", SpotType::CAR);
+    parkingLot.addSpot(1, "L1-C2", SpotType::CAR);
+    parkingLot.addLevel(2);
+    parkingLot.addSpot(2, "L2-M1", SpotType::MOTORCYCLE);
+    parkingLot.addSpot(2, "L2-C1", SpotType::CAR);
+    parkingLot.addSpot(2, "L2-C2", SpotType::CAR);
+
+    cout << "Parking M001 -> " << parkingLot.parkVehicle("M001", VehicleType::MOTORCYCLE) << endl;
+    cout << "Parking C001 -> " << parkingLot.parkVehicle("C001", VehicleType::CAR) << endl;
+    cout << "Parking C002 -> " << parkingLot.parkVehicle("C002", VehicleType::CAR) << endl;
+    parkingLot.printStatus();
+    cout << "Vehicle in spot L1-C1: " << parkingLot.getVehicleInSpot("L1-C1") << endl;
+    parkingLot.unparkVehicle("C001");
+    parkingLot.printStatus();
+
+    cout << "=== Benchmark ===" << endl;
+    Benchmark::runParkUnpark(16, 250000, 5000000);
+    return 0;
+}
+
+/*
+===================================================================
+                    PROBLEM DESCRIPTION
+===================================================================
+
+Same problem as ParkingLot.cpp (park / unpark / find vehicle in spot),
+scaled to a city-wide garage network with millions of spots.
+
+WHAT CHANGES VS ParkingLot.cpp:
+- ParkingLevel kept unordered_set<string> of free spot IDs, addSpot did a
+  linear duplicate scan, and every park/unpark hashed strings through
+  unordered_map<string, ...>. Unpark additionally scanned every level.
+- Here every spot and vehicle is a dense integer handle. Per-spot state
+  (level, type, bucket slot, occupant) and per-vehicle state (type, spot)
+  live in flat arrays indexed by handle.
+- Each (level, SpotType) bucket owns a two-level FreeBitmap. Allocation
+  is __builtin_ctzll on the summary word, then on the slot word.
+- A second FreeBitmap per SpotType tracks which levels still have a free
+  spot of that type, so park never scans levels.
+- Strings are interned once at the API boundary (ParkingLot); callers that
+  keep handles can use SpotAllocator directly.
+
+TIME COMPLEXITY:
+- Park: O(1) expected (two find-first-set lookups)
+- Unpark: O(1)
+- GetVehicle: O(1) array index (plus one hash at the string boundary)
+
+SPACE COMPLEXITY: O(S + V) with ~13 bytes per spot plus 1 bit per spot
+*/
@@ -0,0 +1,454 @@
+/**
+ * Parking Lot Management System - Concurrent Engine
+ *
+ * Gates on different levels park and unpark at the same time. Spots are
+ * claimed with an atomic CAS on per-(level, SpotType) free bitmaps, vehicles
+ * are routed to the level with the most free spots of their type using
+ * relaxed atomic counters, and unpark is wait-free (one exchange, one
+ * fetch_or, one fetch_add).
+ *
+ * The layout (levels and spot counts) is fixed at construction time; only
+ * park/unpark/lookup are concurrent. Handles follow ParkingLotBitmapAllocator.cpp.
+ *
+ * Rules: Motorcycles can park anywhere, Cars need car spots only
+ */
+
+#include <bits/stdc++.h>
+using namespace std;
+
+enum class VehicleType { MOTORCYCLE, CAR };
+enum class SpotType { MOTORCYCLE, CAR };
+
+static constexpr int SPOT_TYPE_COUNT = 2;
+
+using SpotHandle = uint32_t;
+using VehicleHandle = uint32_t;
+static constexpr uint32_t NO_HANDLE = numeric_limits<uint32_t>::max();
+static constexpr size_t CACHE_LINE = 64;
+
+/**
+ * AtomicFreeBitmap is a fixed-size free bitmap safe for concurrent use
+ * claim() clears one set bit with CAS; release() sets a bit with fetch_or.
+ * Each bitmap lives on its own cache lines so levels do not false-share: the
+ * word array is cache-line aligned and padded to a whole number of lines.
+ */
+class AtomicFreeBitmap {
+private:
+    struct AlignedDelete {
+        void operator()(atomic<uint64_t>* p) const { ::operator delete(p, align_val_t{CACHE_LINE}); }
+    };
+
+    unique_ptr<atomic<uint64_t>[], AlignedDelete> words;
+    size_t wordCount = 0;
+
+public:
+    explicit AtomicFreeBitmap(uint32_t slotCount = 0) { reset(slotCount); }
+
+    void reset(uint32_t slotCount) {
+        wordCount = (slotCount + 63) / 64;
+        constexpr size_t wordsPerLine = CACHE_LINE / sizeof(atomic<uint64_t>);
+        size_t allocated = (max<size_t>(wordCount, 1) + wordsPerLine - 1) / wordsPerLine * wordsPerLine;
+        auto* raw = static_cast<atomic<uint64_t>*>(
+            ::operator new(allocated * sizeof(atomic<uint64_t>), align_val_t{CACHE_LINE}));
+        for (size_t w = 0; w < allocated; w++) {
+            new (raw + w) atomic<uint64_t>(0);
+        }
+        words.reset(raw);
+        for (size_t w = 0; w < wordCount; w++) {
+            uint32_t bitsInWord = min<uint32_t>(64, slotCount - w * 64);
+            words[w].store(bitsInWord == 64 ? ~0ULL : ((1ULL << bitsInWord) - 1), memory_order_relaxed);
+        }
+    }
+
+    /**
+     * Claim any free slot, starting the scan at startWord so concurrent
+     * claimers on the same level spread over different words
+     * @return Slot index, or NO_HANDLE if no free slot was seen
+     */
+    uint32_t claim(size_t startWord) {
+        if (wordCount == 0) {
+            return NO_HANDLE;
+        }
+        startWord %= wordCount;
+        for (size_t i = 0; i < wordCount; i++) {
+            size_t w = startWord + i;
+            if (w >= wordCount) w -= wordCount;
+            uint64_t current = words[w].load(memory_order_relaxed);
+            while (current != 0) {
+                uint64_t bit = current & (~current + 1);  // Lowest set bit
+                if (words[w].compare_exchange_weak(current, current & ~bit,
+                                                   memory_order_acquire, memory_order_relaxed)) {
+                    return static_cast<uint32_t>(w * 64 + __builtin_ctzll(bit));
+                }
+                // CAS failure reloaded current; retry within this word
+            }
+        }
+        return NO_HANDLE;
+    }
+
+    /**
+     * Return a slot to the bitmap (wait-free)
+     */
+    void release(uint32_t slot) {
+        words[slot >> 6].fetch_or(1ULL << (slot & 63), memory_order_release);
+    }
+
+    bool isFree(uint32_t slot) const {
+        return (words[slot >> 6].load(memory_order_relaxed) >> (slot & 63)) & 1ULL;
+    }
+};
+
+/**
+ * ConcurrentParkingLot is the lock-free park/unpark engine
+ *
+ * Spot handles are laid out contiguously per bucket:
+ *   handle = bucketBase[level * SPOT_TYPE_COUNT + type] + slot
+ * so translating a bucket slot to a handle is one add.
+ *
+ * Time Complexity:
+ * - park: O(L) relaxed loads for routing + O(words) CAS scan in the worst case
+ * - unpark: O(1), wait-free
+ * - getVehicleInSpot: O(1)
+ */
+class ConcurrentParkingLot {
+private:
+    struct alignas(CACHE_LINE) Bucket {
+        AtomicFreeBitmap freeSlots;
+        atomic<int64_t> freeCount{0};  // Relaxed; only used for routing
+        SpotHandle base = 0;
+        uint32_t slotCount = 0;
+    };
+
+    int levelCount;
+    unique_ptr<Bucket[]> buckets;
+    vector<uint32_t> spotBucket;                         // handle -> bucket index
+    unique_ptr<atomic<VehicleHandle>[]> spotOccupant;    // handle -> vehicle
+    size_t spotCount = 0;
+
+    vector<VehicleType> vehicleType;                     // vehicle -> type (fixed after registration)
+    unique_ptr<atomic<SpotHandle>[]> vehicleSpot;        // vehicle -> spot
+    size_t vehicleCapacity;
+
+    Bucket& bucketFor(int level, SpotType type) {
+        return buckets[level * SPOT_TYPE_COUNT + static_cast<int>(type)];
+    }
+
+    /**
+     * Level with the most free spots of a type, or -1 if all report empty
+     */
+    int pickLevel(SpotType type) {
+        int best = -1;
+        int64_t bestFree = 0;
+        for (int l = 0; l < levelCount; l++) {
+            int64_t freeSpots = bucketFor(l, type).freeCount.load(memory_order_relaxed);
+            if (freeSpots > bestFree) {
+                bestFree = freeSpots;
+                best = l;
+            }
+        }
+        return best;
+    }
+
+    SpotHandle tryClaim(int level, SpotType type, size_t hint) {
+        Bucket& bucket = bucketFor(level, type);
+        uint32_t slot = bucket.freeSlots.claim(hint);
+        if (slot == NO_HANDLE) {
+            return NO_HANDLE;
+        }
+        bucket.freeCount.fetch_sub(1, memory_order_relaxed);
+        return bucket.base + slot;
+    }
+
+    /**
+     * Claim a spot of one type: the routed level first, then every other
+     * level in order in case the counters were stale
+     */
+    SpotHandle claimOfType(SpotType type, size_t hint) {
+        int best = pickLevel(type);
+        if (best >= 0) {
+            SpotHandle spot = tryClaim(best, type, hint);
+            if (spot != NO_HANDLE) return spot;
+        }
+        for (int l = 0; l < levelCount; l++) {
+            if (l == best) continue;
+            SpotHandle spot = tryClaim(l, type, hint);
+            if (spot != NO_HANDLE) return spot;
+        }
+        return NO_HANDLE;
+    }
+
+public:
+    /**
+     * Build a lot from a fixed layout
+     * @param layout layout[l] = {motorcycle spots, car spots} on level l
+     * @param maxVehicles Capacity of the vehicle handle table
+     * @throws invalid_argument if layout is empty
+     */
+    ConcurrentParkingLot(const vector<array<uint32_t, SPOT_TYPE_COUNT>>& layout, size_t maxVehicles)
+        : levelCount(static_cast<int>(layout.size())), vehicleCapacity(maxVehicles) {
+        if (layout.empty()) {
+            throw invalid_argument("Layout must contain at least one level");
+        }
+        buckets.reset(new Bucket[levelCount * SPOT_TYPE_COUNT]);
+        for (int l = 0; l < levelCount; l++) {
+            for (int t = 0; t < SPOT_TYPE_COUNT; t++) {
+                Bucket& bucket = buckets[l * SPOT_TYPE_COUNT + t];
+                bucket.base = static_cast<SpotHandle>(spotCount);
+                bucket.slotCount = layout[l][t];
+                bucket.freeSlots.reset(layout[l][t]);
+                bucket.freeCount.store(layout[l][t], memory_order_relaxed);
+                spotBucket.insert(spotBucket.end(), layout[l][t], l * SPOT_TYPE_COUNT + t);
+                spotCount += layout[l][t];
+            }
+        }
+        spotOccupant.reset(new atomic<VehicleHandle>[spotCount]);
+        for (size_t s = 0; s < spotCount; s++) spotOccupant[s].store(NO_HANDLE, memory_order_relaxed);
+        vehicleSpot.reset(new atomic<SpotHandle>[vehicleCapacity]);
+        for (size_t v = 0; v < vehicleCapacity; v++) vehicleSpot[v].store(NO_HANDLE, memory_order_relaxed);
+        vehicleType.reserve(vehicleCapacity);
+    }
+
+    /**
+     * Register a vehicle (not thread-safe; do this before starting gates)
+     * @throws runtime_error if the vehicle table is full
+     */
+    VehicleHandle addVehicle(VehicleType type) {
+        if (vehicleType.size() >= vehicleCapacity) {
+            throw runtime_error("Vehicle capacity " + to_string(vehicleCapacity) + " exceeded");
+        }
+        vehicleType.push_back(type);
+        return static_cast<VehicleHandle>(vehicleType.size() - 1);
+    }
+
+    /**
+     * Park a vehicle (thread-safe, lock-free)
+     * A vehicle handle must not be parked by two threads at once.
+     * @param hint Scan start for the bitmap, typically the gate/thread index
+     * @return Claimed spot, or NO_HANDLE if the lot is full
+     * @throws runtime_error if the vehicle is already parked
+     */
+    SpotHandle park(VehicleHandle vehicle, size_t hint = 0) {
+        if (vehicleSpot[vehicle].load(memory_order_relaxed) != NO_HANDLE) {
+            throw runtime_error("Vehicle handle " + to_string(vehicle) + " is already parked");
+        }
+        SpotHandle spot = NO_HANDLE;
+        switch (vehicleType[vehicle]) {
+            case VehicleType::MOTORCYCLE:
+                spot = claimOfType(SpotType::MOTORCYCLE, hint);
+                if (spot == NO_HANDLE) {
+                    spot = claimOfType(SpotType::CAR, hint);
+                }
+                break;
+            case VehicleType::CAR:
+                spot = claimOfType(SpotType::CAR, hint);
+                break;
+            default:
+                // Unknown vehicle type - extensible for future vehicle types
+                break;
+        }
+        if (spot != NO_HANDLE) {
+            spotOccupant[spot].store(vehicle, memory_order_release);
+            vehicleSpot[vehicle].store(spot, memory_order_release);
+        }
+        return spot;
+    }
+
+    /**
+     * Unpark a vehicle (thread-safe, wait-free)
+     * @return false if the vehicle was not parked
+     */
+    bool unpark(VehicleHandle vehicle) {
+        SpotHandle spot = vehicleSpot[vehicle].exchange(NO_HANDLE, memory_order_acq_rel);
+        if (spot == NO_HANDLE) {
+            return false;
+        }
+        spotOccupant[spot].store(NO_HANDLE, memory_order_relaxed);
+        Bucket& bucket = buckets[spotBucket[spot]];
+        bucket.freeSlots.release(spot - bucket.base);
+        bucket.freeCount.fetch_add(1, memory_order_relaxed);
+        return true;
+    }
+
+    VehicleHandle getVehicleInSpot(SpotHandle spot) const {
+        return spotOccupant[spot].load(memory_order_acquire);
+    }
+
+    size_t getSpotCount() const { return spotCount; }
+    int getLevelCount() const { return levelCount; }
+    int getSpotLevel(SpotHandle spot) const { return spotBucket[spot] / SPOT_TYPE_COUNT; }
+    SpotType getSpotType(SpotHandle spot) const { return static_cast<SpotType>(spotBucket[spot] % SPOT_TYPE_COUNT); }
+
+    int64_t getFreeCount(int level, SpotType type) {
+        return bucketFor(level, type).freeCount.load(memory_order_relaxed);
+    }
+};
+
+namespace UnitTests {
+    void check(bool condition, const string& message) {
+        cout << (condition ? "✓ " : "✗ ") << message << endl;
+    }
+
+    void testRoutingAndRules() {
+        cout << "\n=== Testing Routing And Rules ===" << endl;
+        ConcurrentParkingLot lot({{1, 1}, {0, 3}}, 16);
+        VehicleHandle car1 = lot.addVehicle(VehicleType::CAR);
+        VehicleHandle moto1 = lot.addVehicle(VehicleType::MOTORCYCLE);
+        VehicleHandle moto2 = lot.addVehicle(VehicleType::MOTORCYCLE);
+
+        SpotHandle spot = lot.park(car1);
+        check(lot.getSpotLevel(spot) == 1, "Car is routed to the level with the most free car spots");
+        spot = lot.park(moto1);
+        check(lot.getSpotType(spot) == SpotType::MOTORCYCLE, "Motorcycle prefers a motorcycle spot");
+        spot = lot.park(moto2);
+        check(lot.getSpotType(spot) == SpotType::CAR, "Motorcycle falls back to a car spot");
+        check(lot.getVehicleInSpot(spot) == moto2, "Lookup returns the parked vehicle");
+        check(lot.unpark(moto2) && lot.getVehicleInSpot(spot) == NO_HANDLE, "Unpark frees the spot");
+        check(!lot.unpark(moto2), "Second unpark of the same vehicle is rejected");
+        try {
+            lot.park(car1);
+            check(false, "Should have thrown exception for already parked vehicle");
+        } catch (const runtime_error& e) {
+            check(true, string("Correctly caught exception for already parked vehicle: ") + e.what());
+        }
+    }
+
+    /**
+     * Multi-threaded stress test
+     * Every thread repeatedly parks and unparks its own vehicles while a
+     * shadow ownership table is CAS-claimed per spot; a failed CAS means two
+     * vehicles were handed the same spot.
+     */
+    void testNoDoubleAllocation(int threadCount, int roundsPerThread) {
+        cout << "\n=== Stress Testing " << threadCount << " Threads ===" << endl;
+        vector<array<uint32_t, SPOT_TYPE_COUNT>> layout(4, {64, 192});
+        int vehiclesPerThread = 400;  // More vehicles than spots so the lot runs full
+        ConcurrentParkingLot lot(layout, threadCount * vehiclesPerThread);
+        vector<vector<VehicleHandle>> owned(threadCount);
+        for (int t = 0; t < threadCount; t++) {
+            for (int i = 0; i < vehiclesPerThread; i++) {
+                owned[t].push_back(lot.addVehicle(i % 3 == 0 ? VehicleType::MOTORCYCLE : VehicleType::CAR));
+            }
+        }
+
+        vector<atomic<VehicleHandle>> shadow(lot.getSpotCount());
+        for (auto& s : shadow) s.store(NO_HANDLE);
+        atomic<int> doubleAllocations{0};
+        atomic<int> wrongTypes{0};
+
+        vector<thread> gates;
+        for (int t = 0; t < threadCount; t++) {
+            gates.emplace_back([&, t]() {
+                mt19937 rng(t);
+                vector<SpotHandle> mySpot(vehiclesPerThread, NO_HANDLE);
+                for (int r = 0; r < roundsPerThread; r++) {
+                    int i = rng() % vehiclesPerThread;
+                    VehicleHandle v = owned[t][i];
+                    if (mySpot[i] == NO_HANDLE) {
+                        SpotHandle spot = lot.park(v, t * 7);
+                        if (spot == NO_HANDLE) continue;
+                        VehicleHandle expected = NO_HANDLE;
+                        if (!shadow[spot].compare_exchange_strong(expected, v)) doubleAllocations++;
+                        if (i % 3 != 0 && lot.getSpotType(spot) != SpotType::CAR) wrongTypes++;
+                        mySpot[i] = spot;
+                    } else {
+                        shadow[mySpot[i]].store(NO_HANDLE);
+                        lot.unpark(v);
+                        mySpot[i] = NO_HANDLE;
+                    }
+                }
+                for (int i = 0; i < vehiclesPerThread; i++) {
+                    if (mySpot[i] != NO_HANDLE) {
+                        shadow[mySpot[i]].store(NO_HANDLE);
+                        lot.unpark(owned[t][i]);
+                    }
+                }
+            });
+        }
+        for (auto& gate : gates) gate.join();
+
+        int64_t freeSpots = 0;
+        for (int l = 0; l < lot.getLevelCount(); l++) {
+            freeSpots += lot.getFreeCount(l, SpotType::MOTORCYCLE) + lot.getFreeCount(l, SpotType::CAR);
+        }
+        check(doubleAllocations.load() == 0, "No spot was handed to two vehicles");
+        check(wrongTypes.load() == 0, "No car was parked in a motorcycle spot");
+        check(freeSpots == static_cast<int64_t>(lot.getSpotCount()), "All spots are free after every vehicle left");
+    }
+
+    void runAllTests() {
+        testRoutingAndRules();
+        testNoDoubleAllocation(8, 200000);
+    }
+}
+
+namespace Benchmark {
+    /**
+     * Park/unpark throughput with one thread per gate
+     */
+    void runThroughput(int threadCount, int levels, uint32_t spotsPerLevel, int opsPerThread) {
+        vector<array<uint32_t, SPOT_TYPE_COUNT>> layout(levels, {spotsPerLevel / 4, spotsPerLevel - spotsPerLevel / 4});
+        int vehiclesPerThread = static_cast<int>(levels * spotsPerLevel / 2 / threadCount);
+        ConcurrentParkingLot lot(layout, static_cast<size_t>(threadCount) * vehiclesPerThread);
+        vector<vector<VehicleHandle>> owned(threadCount);
+        for (int t = 0; t < threadCount; t++) {
+            for (int i = 0; i < vehiclesPerThread; i++) {
+                owned[t].push_back(lot.addVehicle(i % 4 == 0 ? VehicleType::MOTORCYCLE : VehicleType::CAR));
+            }
+        }
+
+        auto start = chrono::steady_clock::now();
+        vector<thread> gates;
+        for (int t = 0; t < threadCount; t++) {
+            gates.emplace_back([&, t]() {
+                for (int i = 0; i < opsPerThread; i++) {
+                    VehicleHandle v = owned[t][i % vehiclesPerThread];
+                    if (!lot.unpark(v)) lot.park(v, t * 64);
+                }
+            });
+        }
+        for (auto& gate : gates) gate.join();
+        double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+        cout << "Threads: " << threadCount << ", spots: " << lot.getSpotCount()
+             << ", ops/sec: " << static_cast<long long>(threadCount * (double)opsPerThread / seconds) << endl;
+    }
+}
+
+int main() {
+    UnitTests::runAllTests();
+
+    cout << "\n=== Benchmark ===" << endl;
+    for (int threads : {1, 2, 4, 8}) {
+        Benchmark::runThroughput(threads, 8, 125000, 2000000);
+    }
+    return 0;
+}
+
+/*
+===================================================================
+                    PROBLEM DESCRIPTION
+===================================================================
+
+Same problem as ParkingLot.cpp, but multiple gates call park/unpark
+concurrently. ParkingLot.cpp has no synchronization at all.
+
+APPROACH:
+- Each (level, SpotType) bucket owns an AtomicFreeBitmap. A spot is
+  claimed by CAS-clearing the lowest set bit of a non-zero word; the scan
+  starts at a per-gate word offset so gates rarely fight over one word.
+- Each bucket also keeps a relaxed atomic free counter. Park routes the
+  vehicle to the level with the most free spots of its type; if the
+  counters were stale and the claim fails, the other levels are tried.
+- Unpark is an exchange on vehicleSpot, a fetch_or on the bitmap word and
+  a fetch_add on the counter: a fixed number of steps, i.e. wait-free.
+- The layout is fixed at construction; vehicles are registered up front.
+
+GUARANTEES:
+- A spot bit can only be cleared by one successful CAS, so no spot is
+  ever handed to two vehicles (verified by the stress test).
+- Counters are hints only; correctness never depends on them.
+
+TIME COMPLEXITY:
+- Park: O(L) routing + O(W) worst-case bitmap scan, lock-free
+- Unpark: O(1), wait-free
+- GetVehicle: O(1)
+*/
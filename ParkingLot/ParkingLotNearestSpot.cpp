@@ -0,0 +1,614 @@
+/**
+ * Parking Lot Management System - Nearest Spot To Entrance
+ *
+ * ParkingLevel::findAvailableSpotId in ParkingLot.cpp returns
+ * *availableCarSpotIds.begin(), which is an arbitrary spot. Here every gate
+ * keeps, per SpotType, the spots of the whole lot ranked by walking distance
+ * from that gate (Manhattan distance on the level plus a per-level ramp
+ * cost). Free ranks are stored in a 64-ary hierarchical bitset (van Emde Boas
+ * style layering), so "closest free spot of type T from gate G" is a
+ * find-first-set descent of depth log64(n): 4 words for 16M spots.
+ *
+ * Rules: Motorcycles can park anywhere, Cars need car spots only
+ */
+
+#include <bits/stdc++.h>
+using namespace std;
+
+enum class VehicleType { MOTORCYCLE, CAR };
+enum class SpotType { MOTORCYCLE, CAR };
+
+static constexpr int SPOT_TYPE_COUNT = 2;
+
+using SpotHandle = uint32_t;
+using VehicleHandle = uint32_t;
+static constexpr uint32_t NO_HANDLE = numeric_limits<uint32_t>::max();
+
+class Vehicle {
+public:
+    string vehicleId;
+    VehicleType type;
+    string licensePlate;
+
+    Vehicle(const string& vehicleId, VehicleType vehicleType, const string& plate)
+        : vehicleId(vehicleId), type(vehicleType), licensePlate(plate) {
+        if (vehicleId.empty()) {
+            throw invalid_argument("Vehicle ID cannot be empty");
+        }
+        if (plate.empty()) {
+            throw invalid_argument("License plate cannot be empty");
+        }
+    }
+};
+
+/**
+ * HierarchicalBitset is a 64-ary summary tree over a fixed-size bitset
+ * layers[0] holds the bits; bit j of layers[k + 1] is set when word j of
+ * layers[k] is non-zero. The top layer is a single word.
+ */
+class HierarchicalBitset {
+private:
+    vector<vector<uint64_t>> layers;
+
+public:
+    explicit HierarchicalBitset(uint32_t size = 0) {
+        size_t words = max<size_t>(1, (size + 63) / 64);
+        layers.emplace_back(words, 0);
+        while (words > 1) {
+            words = (words + 63) / 64;
+            layers.emplace_back(words, 0);
+        }
+    }
+
+    void set(uint32_t index) {
+        size_t i = index;
+        for (auto& layer : layers) {
+            uint64_t& word = layer[i >> 6];
+            bool wasEmpty = word == 0;
+            word |= 1ULL << (i & 63);
+            if (!wasEmpty) return;
+            i >>= 6;
+        }
+    }
+
+    void clear(uint32_t index) {
+        size_t i = index;
+        for (auto& layer : layers) {
+            uint64_t& word = layer[i >> 6];
+            word &= ~(1ULL << (i & 63));
+            if (word != 0) return;
+            i >>= 6;
+        }
+    }
+
+    bool test(uint32_t index) const {
+        return (layers[0][index >> 6] >> (index & 63)) & 1ULL;
+    }
+
+    /**
+     * Lowest set index, or NO_HANDLE if empty
+     * Time Complexity: O(log64 n)
+     */
+    uint32_t findFirst() const {
+        if (layers.back()[0] == 0) {
+            return NO_HANDLE;
+        }
+        size_t i = 0;
+        for (size_t k = layers.size(); k-- > 0;) {
+            i = (i << 6) + __builtin_ctzll(layers[k][i]);
+        }
+        return static_cast<uint32_t>(i);
+    }
+};
+
+/**
+ * NearestSpotIndex answers "closest free spot of type T from gate G"
+ *
+ * Usage: add levels, spots and gates, then call build(). After build the
+ * layout is frozen and claim/release keep every gate's bitset in sync.
+ *
+ * Time Complexity (after build):
+ * - closestFree: O(log64 n)
+ * - claim / release: O(G * log64 n) for G gates
+ * - build: O(G * n log n)
+ */
+class NearestSpotIndex {
+private:
+    struct SpotInfo {
+        uint32_t level;
+        SpotType type;
+        int x, y;
+    };
+    struct Gate {
+        uint32_t level;
+        int x, y;
+        // Per SpotType: rank -> spot, and the bitset of free ranks
+        vector<SpotHandle> rankToSpot[SPOT_TYPE_COUNT];
+        HierarchicalBitset freeRanks[SPOT_TYPE_COUNT];
+    };
+
+    int levelPenalty;            // Walking cost of moving one level up or down
+    uint32_t levelCount = 0;
+    vector<SpotInfo> spots;
+    vector<Gate> gates;
+    vector<uint32_t> spotRank;   // gate * spotCount + spot -> rank of spot for that gate
+    vector<bool> spotFree;
+    bool built = false;
+
+    long long distance(const Gate& gate, const SpotInfo& spot) const {
+        long long levelGap = abs(static_cast<long long>(gate.level) - static_cast<long long>(spot.level));
+        return levelGap * levelPenalty + abs(gate.x - spot.x) + abs(gate.y - spot.y);
+    }
+
+    void requireBuilt(bool expected) const {
+        if (built != expected) {
+            throw runtime_error(expected ? "Index must be built first" : "Layout is frozen after build()");
+        }
+    }
+
+public:
+    explicit NearestSpotIndex(int levelPenalty) : levelPenalty(levelPenalty) {
+        if (levelPenalty < 0) {
+            throw invalid_argument("Level penalty cannot be negative");
+        }
+    }
+
+    uint32_t addLevel() {
+        requireBuilt(false);
+        return levelCount++;
+    }
+
+    /**
+     * @throws invalid_argument if the level index is unknown
+     */
+    SpotHandle addSpot(uint32_t level, SpotType type, int x, int y) {
+        requireBuilt(false);
+        if (level >= levelCount) {
+            throw invalid_argument("Unknown level index " + to_string(level));
+        }
+        spots.push_back({level, type, x, y});
+        return static_cast<SpotHandle>(spots.size() - 1);
+    }
+
+    /**
+     * @throws invalid_argument if the level index is unknown
+     */
+    uint32_t addGate(uint32_t level, int x, int y) {
+        requireBuilt(false);
+        if (level >= levelCount) {
+            throw invalid_argument("Unknown level index " + to_string(level));
+        }
+        gates.emplace_back();
+        gates.back().level = level;
+        gates.back().x = x;
+        gates.back().y = y;
+        return static_cast<uint32_t>(gates.size() - 1);
+    }
+
+    /**
+     * Rank every spot by distance from every gate and mark all spots free
+     * Ties are broken by spot handle so the order is deterministic
+     */
+    void build() {
+        requireBuilt(false);
+        size_t spotCount = spots.size();
+        spotRank.assign(gates.size() * spotCount, 0);
+        spotFree.assign(spotCount, true);
+        for (size_t g = 0; g < gates.size(); g++) {
+            Gate& gate = gates[g];
+            for (int t = 0; t < SPOT_TYPE_COUNT; t++) {
+                vector<pair<long long, SpotHandle>> order;
+                for (SpotHandle s = 0; s < spotCount; s++) {
+                    if (static_cast<int>(spots[s].type) == t) {
+                        order.push_back({distance(gate, spots[s]), s});
+                    }
+                }
+                sort(order.begin(), order.end());
+                gate.rankToSpot[t].resize(order.size());
+                gate.freeRanks[t] = HierarchicalBitset(static_cast<uint32_t>(order.size()));
+                for (uint32_t r = 0; r < order.size(); r++) {
+                    gate.rankToSpot[t][r] = order[r].second;
+                    spotRank[g * spotCount + order[r].second] = r;
+                    gate.freeRanks[t].set(r);
+                }
+            }
+        }
+        built = true;
+    }
+
+    /**
+     * Closest free spot of a type from a gate, without claiming it
+     * @return Spot handle, or NO_HANDLE if no spot of that type is free
+     */
+    SpotHandle closestFree(uint32_t gate, SpotType type) const {
+        const Gate& g = gates[gate];
+        uint32_t rank = g.freeRanks[static_cast<int>(type)].findFirst();
+        return rank == NO_HANDLE ? NO_HANDLE : g.rankToSpot[static_cast<int>(type)][rank];
+    }
+
+    /**
+     * Mark a spot occupied in every gate's ordering
+     * @throws runtime_error if the spot is already occupied
+     */
+    void claim(SpotHandle spot) {
+        requireBuilt(true);
+        if (!spotFree[spot]) {
+            throw runtime_error("Spot handle " + to_string(spot) + " is already occupied");
+        }
+        spotFree[spot] = false;
+        int t = static_cast<int>(spots[spot].type);
+        for (size_t g = 0; g < gates.size(); g++) {
+            gates[g].freeRanks[t].clear(spotRank[g * spots.size() + spot]);
+        }
+    }
+
+    /**
+     * Mark a spot free in every gate's ordering
+     * @throws runtime_error if the spot is already free
+     */
+    void release(SpotHandle spot) {
+        requireBuilt(true);
+        if (spotFree[spot]) {
+            throw runtime_error("Spot handle " + to_string(spot) + " is already free");
+        }
+        spotFree[spot] = true;
+        int t = static_cast<int>(spots[spot].type);
+        for (size_t g = 0; g < gates.size(); g++) {
+            gates[g].freeRanks[t].set(spotRank[g * spots.size() + spot]);
+        }
+    }
+
+    long long distanceFromGate(uint32_t gate, SpotHandle spot) const { return distance(gates[gate], spots[spot]); }
+    SpotType getSpotType(SpotHandle spot) const { return spots[spot].type; }
+    size_t getGateCount() const { return gates.size(); }
+    size_t getSpotCount() const { return spots.size(); }
+};
+
+/**
+ * ParkingLot with the same park / unpark / getVehicleInSpot API as
+ * ParkingLot.cpp, backed by NearestSpotIndex. parkVehicle takes the gate
+ * the vehicle entered through; the single-argument overload uses gate 0.
+ */
+class ParkingLot {
+private:
+    NearestSpotIndex index;
+    unordered_map<int, uint32_t> levelNumberToIndex;
+    unordered_map<string, SpotHandle> spotIdToHandle;
+    vector<string> spotIds;
+    vector<Vehicle*> spotOccupant;
+    unordered_map<string, uint32_t> gateIdToIndex;
+    string defaultGateId;                            // First gate added, used by parkVehicle(Vehicle*)
+    unordered_map<string, SpotHandle> vehicleIdToSpot;
+    bool opened = false;
+
+    void requireOpen() {
+        if (!opened) {
+            index.build();
+            spotOccupant.assign(spotIds.size(), nullptr);
+            opened = true;
+        }
+    }
+
+public:
+    explicit ParkingLot(int levelPenalty = 100) : index(levelPenalty) {}
+
+    /**
+     * @throws invalid_argument if levelNumber is less than 1
+     * @throws runtime_error if level number already exists
+     */
+    void addLevel(int levelNumber) {
+        if (levelNumber < 1) {
+            throw invalid_argument("Level number must be at least 1");
+        }
+        if (levelNumberToIndex.count(levelNumber)) {
+            throw runtime_error("Level " + to_string(levelNumber) + " already exists");
+        }
+        levelNumberToIndex[levelNumber] = index.addLevel();
+    }
+
+    /**
+     * @throws invalid_argument if spotId is empty
+     * @throws runtime_error if level is unknown or spotId already exists
+     */
+    void addSpot(int levelNumber, const string& spotId, SpotType type, int x, int y) {
+        if (spotId.empty()) {
+            throw invalid_argument("Spot ID cannot be empty");
+        }
+        auto levelIt = levelNumberToIndex.find(levelNumber);
+        if (levelIt == levelNumberToIndex.end()) {
+            throw runtime_error("Level " + to_string(levelNumber) + " does not exist");
+        }
+        if (spotIdToHandle.count(spotId)) {
+            throw runtime_error("Spot ID " + spotId + " already exists");
+        }
+        spotIdToHandle[spotId] = index.addSpot(levelIt->second, type, x, y);
+        spotIds.push_back(spotId);
+    }
+
+    /**
+     * @throws invalid_argument if gateId is empty
+     * @throws runtime_error if level is unknown or gateId already exists
+     */
+    void addGate(const string& gateId, int levelNumber, int x, int y) {
+        if (gateId.empty()) {
+            throw invalid_argument("Gate ID cannot be empty");
+        }
+        auto levelIt = levelNumberToIndex.find(levelNumber);
+        if (levelIt == levelNumberToIndex.end()) {
+            throw runtime_error("Level " + to_string(levelNumber) + " does not exist");
+        }
+        if (gateIdToIndex.count(gateId)) {
+            throw runtime_error("Gate " + gateId + " already exists");
+        }
+        gateIdToIndex[gateId] = index.addGate(levelIt->second, x, y);
+        if (defaultGateId.empty()) {
+            defaultGateId = gateId;
+        }
+    }
+
+    /**
+     * Park a vehicle in the closest free spot to the gate it entered through
+     * Motorcycles take the closest motorcycle spot, falling back to the
+     * closest car spot when no motorcycle spot is free
+     * @return spotId, empty string if no spot is available
+     * @throws invalid_argument if vehicle pointer is null
+     * @throws runtime_error if gate is unknown or vehicle is already parked
+     */
+    string parkVehicle(Vehicle* vehicle, const string& gateId) {
+        if (vehicle == nullptr) {
+            throw invalid_argument("Vehicle pointer cannot be null");
+        }
+        auto gateIt = gateIdToIndex.find(gateId);
+        if (gateIt == gateIdToIndex.end()) {
+            throw runtime_error("Gate " + gateId + " does not exist");
+        }
+        if (vehicleIdToSpot.count(vehicle->vehicleId)) {
+            throw runtime_error("Vehicle " + vehicle->vehicleId + " is already parked");
+        }
+        requireOpen();
+
+        SpotHandle spot = NO_HANDLE;
+        switch (vehicle->type) {
+            case VehicleType::MOTORCYCLE:
+                spot = index.closestFree(gateIt->second, SpotType::MOTORCYCLE);
+                if (spot == NO_HANDLE) {
+                    spot = index.closestFree(gateIt->second, SpotType::CAR);
+                }
+                break;
+            case VehicleType::CAR:
+                spot = index.closestFree(gateIt->second, SpotType::CAR);
+                break;
+            default:
+                // Unknown vehicle type - extensible for future vehicle types
+                break;
+        }
+        if (spot == NO_HANDLE) {
+            return "";
+        }
+        index.claim(spot);
+        spotOccupant[spot] = vehicle;
+        vehicleIdToSpot[vehicle->vehicleId] = spot;
+        return spotIds[spot];
+    }
+
+    /**
+     * Same signature as ParkingLot::parkVehicle in ParkingLot.cpp; uses the first gate
+     * @throws runtime_error if the lot has no gates
+     */
+    bool parkVehicle(Vehicle* vehicle) {
+        if (defaultGateId.empty()) {
+            throw runtime_error("Parking lot has no gates");
+        }
+        return !parkVehicle(vehicle, defaultGateId).empty();
+    }
+
+    /**
+     * @throws invalid_argument if vehicleId is empty
+     * @throws runtime_error if vehicle is not parked
+     */
+    bool unparkVehicle(const string& vehicleId) {
+        if (vehicleId.empty()) {
+            throw invalid_argument("Vehicle ID cannot be empty");
+        }
+        auto it = vehicleIdToSpot.find(vehicleId);
+        if (it == vehicleIdToSpot.end()) {
+            throw runtime_error("Vehicle " + vehicleId + " is not parked in this lot");
+        }
+        index.release(it->second);
+        spotOccupant[it->second] = nullptr;
+        vehicleIdToSpot.erase(it);
+        return true;
+    }
+
+    /**
+     * @throws invalid_argument if spotId is empty
+     * @throws runtime_error if spot doesn't exist
+     */
+    Vehicle* getVehicleInSpot(const string& spotId) {
+        if (spotId.empty()) {
+            throw invalid_argument("Spot ID cannot be empty");
+        }
+        auto it = spotIdToHandle.find(spotId);
+        if (it == spotIdToHandle.end()) {
+            throw runtime_error("Spot " + spotId + " does not exist");
+        }
+        // A lookup must not freeze the layout; before the first park every spot is empty
+        if (!opened) {
+            return nullptr;
+        }
+        return spotOccupant[it->second];
+    }
+};
+
+namespace UnitTests {
+    void check(bool condition, const string& message) {
+        cout << (condition ? "✓ " : "✗ ") << message << endl;
+    }
+
+    void testHierarchicalBitset() {
+        cout << "\n=== Testing HierarchicalBitset ===" << endl;
+        HierarchicalBitset bits(300000);
+        check(bits.findFirst() == NO_HANDLE, "Empty bitset has no first bit");
+        bits.set(299999);
+        bits.set(4096);
+        check(bits.findFirst() == 4096, "findFirst returns the lowest set bit");
+        bits.clear(4096);
+        check(bits.findFirst() == 299999, "Clearing propagates through summary layers");
+    }
+
+    void testNearestAssignment() {
+        cout << "\n=== Testing Nearest Assignment ===" << endl;
+        ParkingLot lot(50);
+        lot.addLevel(1);
+        lot.addLevel(2);
+        lot.addSpot(1, "L1-C-far", SpotType::CAR, 40, 0);
+        lot.addSpot(1, "L1-C-near", SpotType::CAR, 3, 0);
+        lot.addSpot(1, "L1-M1", SpotType::MOTORCYCLE, 20, 0);
+        lot.addSpot(2, "L2-C1", SpotType::CAR, 0, 0);
+        check(lot.getVehicleInSpot("L1-C-far") == nullptr, "Lookup before the first park finds an empty spot");
+        lot.addGate("EAST", 1, 40, 0);
+        lot.addGate("WEST", 1, 0, 0);
+        lot.addSpot(1, "L1-M2", SpotType::MOTORCYCLE, 90, 0);
+        check(lot.getVehicleInSpot("L1-M2") == nullptr, "Lookups do not freeze the layout");
+
+        Vehicle car1("C001", VehicleType::CAR, "CAR1");
+        Vehicle car2("C002", VehicleType::CAR, "CAR2");
+        Vehicle car3("C003", VehicleType::CAR, "CAR3");
+        Vehicle moto("M001", VehicleType::MOTORCYCLE, "BIKE1");
+        check(lot.parkVehicle(&car1, "WEST") == "L1-C-near", "West gate gets the spot 3 away");
+        check(lot.parkVehicle(&car2, "WEST") == "L1-C-far", "Next car gets the far spot before changing level");
+        check(lot.parkVehicle(&car3, "EAST") == "L2-C1", "Level change is used once the level is full");
+        check(lot.parkVehicle(&moto, "EAST") == "L1-M1", "Motorcycle takes the motorcycle spot");
+
+        lot.unparkVehicle("C002");
+        Vehicle car4("C004", VehicleType::CAR, "CAR4");
+        check(lot.parkVehicle(&car4, "EAST") == "L1-C-far", "East gate gets the freed spot right next to it");
+        check(lot.getVehicleInSpot("L1-C-far") == &car4, "Lookup returns the parked vehicle");
+        lot.unparkVehicle("C001");
+        Vehicle car5("C005", VehicleType::CAR, "CAR5");
+        check(lot.parkVehicle(&car5) && lot.getVehicleInSpot("L2-C1") != &car5, "Default overload parks from the first gate");
+
+        try {
+            lot.parkVehicle(&car4, "NORTH");
+            check(false, "Should have thrown exception for unknown gate");
+        } catch (const runtime_error& e) {
+            check(true, string("Correctly caught exception for unknown gate: ") + e.what());
+        }
+    }
+
+    void testAgainstLinearScan() {
+        cout << "\n=== Testing Against Linear Scan ===" << endl;
+        NearestSpotIndex index(30);
+        mt19937 rng(7);
+        for (int l = 0; l < 3; l++) {
+            uint32_t level = index.addLevel();
+            for (int s = 0; s < 2000; s++) {
+                index.addSpot(level, rng() % 5 == 0 ? SpotType::MOTORCYCLE : SpotType::CAR, rng() % 200, rng() % 200);
+            }
+            index.addGate(level, rng() % 200, rng() % 200);
+        }
+        index.build();
+
+        vector<bool> occupied(index.getSpotCount(), false);
+        bool allMatch = true;
+        for (int step = 0; step < 5000; step++) {
+            uint32_t gate = rng() % index.getGateCount();
+            SpotHandle got = index.closestFree(gate, SpotType::CAR);
+            long long best = LLONG_MAX;
+            for (SpotHandle s = 0; s < index.getSpotCount(); s++) {
+                if (!occupied[s] && index.getSpotType(s) == SpotType::CAR) {
+                    best = min(best, index.distanceFromGate(gate, s));
+                }
+            }
+            if (got == NO_HANDLE || index.distanceFromGate(gate, got) != best) allMatch = false;
+            index.claim(got);
+            occupied[got] = true;
+            SpotHandle leaving = rng() % index.getSpotCount();
+            if (occupied[leaving]) {
+                index.release(leaving);
+                occupied[leaving] = false;
+            }
+        }
+        check(allMatch, "Index always returns a spot at minimum distance");
+    }
+
+    void runAllTests() {
+        testHierarchicalBitset();
+        testNearestAssignment();
+        testAgainstLinearScan();
+    }
+}
+
+namespace Benchmark {
+    void runClosestFree(int levels, int spotsPerLevel, int gatesPerLevel, int operations) {
+        NearestSpotIndex index(100);
+        mt19937 rng(42);
+        for (int l = 0; l < levels; l++) {
+            uint32_t level = index.addLevel();
+            for (int s = 0; s < spotsPerLevel; s++) {
+                index.addSpot(level, s % 4 == 0 ? SpotType::MOTORCYCLE : SpotType::CAR, s % 1000, s / 1000);
+            }
+            for (int g = 0; g < gatesPerLevel; g++) {
+                index.addGate(level, rng() % 1000, rng() % (spotsPerLevel / 1000 + 1));
+            }
+        }
+        auto buildStart = chrono::steady_clock::now();
+        index.build();
+        double buildMs = chrono::duration<double, milli>(chrono::steady_clock::now() - buildStart).count();
+
+        vector<SpotHandle> parked;
+        auto start = chrono::steady_clock::now();
+        for (int i = 0; i < operations; i++) {
+            SpotHandle spot = index.closestFree(rng() % index.getGateCount(), SpotType::CAR);
+            if (spot != NO_HANDLE) {
+                index.claim(spot);
+                parked.push_back(spot);
+            }
+            if (parked.size() > 1000 && (i & 1)) {
+                size_t idx = rng() % parked.size();
+                index.release(parked[idx]);
+                parked[idx] = parked.back();
+                parked.pop_back();
+            }
+        }
+        double elapsed = chrono::duration<double, nano>(chrono::steady_clock::now() - start).count();
+        cout << "Spots: " << index.getSpotCount() << ", gates: " << index.getGateCount()
+             << ", build ms: " << buildMs << ", avg ns per park(+unpark): " << elapsed / operations << endl;
+    }
+}
+
+int main() {
+    UnitTests::runAllTests();
+
+    cout << "\n=== Benchmark ===" << endl;
+    Benchmark::runClosestFree(4, 250000, 2, 2000000);
+    return 0;
+}
+
+/*
+===================================================================
+                    PROBLEM DESCRIPTION
+===================================================================
+
+Same problem as ParkingLot.cpp, with one more requirement: a vehicle must
+be given the free spot nearest to the gate it entered through, and that
+must stay fast with millions of spots.
+
+APPROACH:
+- Every spot has (level, x, y); every gate has (level, x, y).
+  distance = |level gap| * levelPenalty + |dx| + |dy|
+- At build() each gate sorts the spots of each SpotType by distance.
+  Rank r of gate G / type T is the r-th closest spot of that type.
+- Free ranks are kept in a HierarchicalBitset: a 64-ary tree of words
+  (van Emde Boas style layering). findFirst descends one word per layer,
+  so the closest free spot costs O(log64 n) - 4 word reads at 16M spots.
+- Parking claims the spot in every gate's bitset; unparking releases it
+  in every gate's bitset. Both are O(G * log64 n).
+
+TIME COMPLEXITY:
+- Closest free spot of type T: O(log64 n)
+- Park / Unpark: O(G * log64 n)
+- Build: O(G * n log n)
+
+SPACE COMPLEXITY: O(G * n) ranks (8 bytes per gate per spot) + bitsets
+*/
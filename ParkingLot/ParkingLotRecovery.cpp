@@ -0,0 +1,786 @@
+/**
+ * Parking Lot Management System - Occupancy Log And Snapshot Recovery
+ *
+ * After a crash ParkingLot.cpp can only be rebuilt by replaying every call.
+ * Here every park/unpark is appended to a binary occupancy log (group
+ * committed in batches), and a compact snapshot of the occupancy bitmap is
+ * written periodically. Recovery loads the latest snapshot and replays only
+ * the log records written after it.
+ *
+ * Spots and vehicles are dense integer handles as in
+ * ParkingLotBitmapAllocator.cpp; the spot layout itself is configuration
+ * and is not logged.
+ *
+ * Rules: Motorcycles can park anywhere, Cars need car spots only
+ */
+
+#include <bits/stdc++.h>
+#include <fcntl.h>
+#include <unistd.h>
+using namespace std;
+
+enum class VehicleType { MOTORCYCLE, CAR };
+enum class SpotType { MOTORCYCLE, CAR };
+
+static constexpr int SPOT_TYPE_COUNT = 2;
+
+using SpotHandle = uint32_t;
+using VehicleHandle = uint32_t;
+static constexpr uint32_t NO_HANDLE = numeric_limits<uint32_t>::max();
+
+/**
+ * FreeBitmap - same two-level find-first-set bitmap as ParkingLotBitmapAllocator.cpp,
+ * with a bulk rebuild used by recovery
+ */
+class FreeBitmap {
+private:
+    vector<uint64_t> words;
+    vector<uint64_t> summary;
+    uint32_t freeCount = 0;
+    mutable size_t summaryHint = 0;
+
+public:
+    void resize(uint32_t slotCount) {
+        words.assign((slotCount + 63) / 64 + 1, 0);
+        summary.assign(words.size() / 64 + 1, 0);
+        freeCount = 0;
+        summaryHint = 0;
+    }
+
+    void markFree(uint32_t slot) {
+        size_t w = slot >> 6;
+        words[w] |= (1ULL << (slot & 63));
+        summary[w >> 6] |= (1ULL << (w & 63));
+        summaryHint = min(summaryHint, w >> 6);
+        freeCount++;
+    }
+
+    void markUsed(uint32_t slot) {
+        size_t w = slot >> 6;
+        words[w] &= ~(1ULL << (slot & 63));
+        if (words[w] == 0) {
+            summary[w >> 6] &= ~(1ULL << (w & 63));
+        }
+        freeCount--;
+    }
+
+    uint32_t findFirstFree() const {
+        if (freeCount == 0) {
+            return NO_HANDLE;
+        }
+        while (summary[summaryHint] == 0) {
+            summaryHint++;
+        }
+        size_t w = (summaryHint << 6) + __builtin_ctzll(summary[summaryHint]);
+        return static_cast<uint32_t>((w << 6) + __builtin_ctzll(words[w]));
+    }
+
+    uint32_t getFreeCount() const { return freeCount; }
+};
+
+/**
+ * LogRecord is one fixed-size park/unpark event
+ * The op lives in the top bit of spot so a record is exactly 16 bytes.
+ */
+struct LogRecord {
+    uint64_t sequence;
+    VehicleHandle vehicle;
+    uint32_t spotAndOp;
+
+    static constexpr uint32_t UNPARK_BIT = 1u << 31;
+
+    bool isUnpark() const { return spotAndOp & UNPARK_BIT; }
+    SpotHandle spot() const { return spotAndOp & ~UNPARK_BIT; }
+};
+static_assert(sizeof(LogRecord) == 16, "LogRecord must stay 16 bytes on disk");
+
+/**
+ * OccupancyLog is an append-only file of LogRecords with group commit
+ * Records are buffered and written with one fwrite (+ optional fsync) per
+ * batch, so the syscall/fsync cost is paid once per batch, not per event.
+ */
+class OccupancyLog {
+private:
+    FILE* file = nullptr;
+    vector<LogRecord> pending;
+    size_t batchSize;
+    bool durable;                 // fsync on every group commit
+    uint64_t committedBytes = 0;  // File offset after the last commit
+
+public:
+    /**
+     * @param path Log file, opened for append (created if missing)
+     * @param batchSize Records per group commit
+     * @param durable When true, fsync after every group commit
+     * @throws runtime_error if the file cannot be opened
+     */
+    OccupancyLog(const string& path, size_t batchSize, bool durable)
+        : batchSize(batchSize), durable(durable) {
+        file = fopen(path.c_str(), "ab");
+        if (file == nullptr) {
+            throw runtime_error("Cannot open occupancy log " + path);
+        }
+        fseek(file, 0, SEEK_END);
+        committedBytes = ftell(file);
+        pending.reserve(batchSize);
+    }
+
+    /**
+     * Commits what is still pending; a failure here cannot be reported, so
+     * callers that need to know call commit() themselves first
+     */
+    ~OccupancyLog() {
+        try {
+            commit();
+        } catch (const runtime_error&) {
+            // Pending records are lost, exactly as in a crash before commit
+        }
+        fclose(file);
+    }
+
+    OccupancyLog(const OccupancyLog&) = delete;
+    OccupancyLog& operator=(const OccupancyLog&) = delete;
+
+    /**
+     * Buffer a record, committing the group when it is full
+     * @throws runtime_error if that commit fails; the record is then dropped, so
+     * the caller must not apply the event
+     */
+    void append(const LogRecord& record) {
+        pending.push_back(record);
+        if (pending.size() >= batchSize) {
+            try {
+                commit();
+            } catch (const runtime_error&) {
+                pending.pop_back();
+                throw;
+            }
+        }
+    }
+
+    /**
+     * Write all pending records as one group
+     * @throws runtime_error on a short write or a failed fsync
+     */
+    void commit() {
+        if (pending.empty()) {
+            return;
+        }
+        size_t written = fwrite(pending.data(), sizeof(LogRecord), pending.size(), file);
+        if (written != pending.size() || fflush(file) != 0) {
+            throw runtime_error("Short write to occupancy log");
+        }
+        if (durable && fsync(fileno(file)) != 0) {
+            throw runtime_error("fsync of occupancy log failed");
+        }
+        committedBytes += written * sizeof(LogRecord);
+        pending.clear();
+    }
+
+    uint64_t getCommittedBytes() const { return committedBytes; }
+};
+
+/**
+ * DurableParkingLot is the park/unpark engine with a log and snapshots
+ *
+ * Spot handles are contiguous per (level, SpotType) bucket:
+ *   handle = bucketBase[level * SPOT_TYPE_COUNT + type] + slot
+ *
+ * Snapshot file layout (little-endian, native struct packing):
+ *   SnapshotHeader
+ *   uint64_t occupied[ceil(spotCount / 64)]    occupancy bitmap
+ *   VehicleHandle occupant[popcount(occupied)] occupant of each set bit, in order
+ */
+class DurableParkingLot {
+private:
+    struct SnapshotHeader {
+        uint64_t magic;
+        uint64_t lastSequence;   // Last log sequence reflected in the snapshot
+        uint64_t logOffset;      // Log byte offset right after that record
+        uint64_t spotCount;
+        uint64_t occupiedCount;
+    };
+    static constexpr uint64_t SNAPSHOT_MAGIC = 0x31504E5350524B50ULL;  // "PKRPSNP1"
+
+    struct Bucket {
+        FreeBitmap freeSlots;
+        SpotHandle base = 0;
+        uint32_t slotCount = 0;
+    };
+
+    int levelCount;
+    vector<Bucket> buckets;
+    vector<uint32_t> spotBucket;         // handle -> bucket index
+    vector<VehicleHandle> spotOccupant;  // handle -> vehicle
+    vector<SpotHandle> vehicleSpot;      // vehicle -> spot (grows on demand)
+
+    string logPath;
+    string snapshotPath;
+    size_t groupCommitSize;
+    bool durable;
+    unique_ptr<OccupancyLog> log;
+    uint64_t nextSequence = 1;
+    uint64_t snapshotEvery;              // Records between automatic snapshots (0 = never)
+    uint64_t recordsSinceSnapshot = 0;
+
+    SpotHandle findOfType(SpotType type) const {
+        for (int l = 0; l < levelCount; l++) {
+            const Bucket& bucket = buckets[l * SPOT_TYPE_COUNT + static_cast<int>(type)];
+            uint32_t slot = bucket.freeSlots.findFirstFree();
+            if (slot != NO_HANDLE) {
+                return bucket.base + slot;
+            }
+        }
+        return NO_HANDLE;
+    }
+
+    void applyPark(VehicleHandle vehicle, SpotHandle spot) {
+        if (vehicle >= vehicleSpot.size()) {
+            vehicleSpot.resize(max<size_t>(vehicle + 1, vehicleSpot.size() * 2), NO_HANDLE);
+        }
+        Bucket& bucket = buckets[spotBucket[spot]];
+        bucket.freeSlots.markUsed(spot - bucket.base);
+        spotOccupant[spot] = vehicle;
+        vehicleSpot[vehicle] = spot;
+    }
+
+    void applyUnpark(VehicleHandle vehicle, SpotHandle spot) {
+        Bucket& bucket = buckets[spotBucket[spot]];
+        bucket.freeSlots.markFree(spot - bucket.base);
+        spotOccupant[spot] = NO_HANDLE;
+        vehicleSpot[vehicle] = NO_HANDLE;
+    }
+
+    /**
+     * Append an event before it is applied, so a failed group commit leaves
+     * memory at the last logged state
+     */
+    void logEvent(VehicleHandle vehicle, SpotHandle spot, bool unpark) {
+        log->append({nextSequence, vehicle, spot | (unpark ? LogRecord::UNPARK_BIT : 0)});
+        nextSequence++;
+    }
+
+    void snapshotIfDue() {
+        if (snapshotEvery > 0 && ++recordsSinceSnapshot >= snapshotEvery) {
+            writeSnapshot();
+        }
+    }
+
+    /**
+     * fsync a directory so a rename inside it survives a crash
+     * @throws runtime_error if the directory cannot be synced
+     */
+    static void syncDirectory(const string& path) {
+        string directory = filesystem::path(path).parent_path().string();
+        int fd = open(directory.empty() ? "." : directory.c_str(), O_RDONLY | O_DIRECTORY);
+        bool ok = fd >= 0 && fsync(fd) == 0;
+        if (fd >= 0) {
+            close(fd);
+        }
+        if (!ok) {
+            throw runtime_error("fsync of directory " + directory + " failed");
+        }
+    }
+
+    void resetState() {
+        for (Bucket& bucket : buckets) {
+            bucket.freeSlots.resize(bucket.slotCount);
+        }
+        fill(spotOccupant.begin(), spotOccupant.end(), NO_HANDLE);
+        vehicleSpot.clear();
+    }
+
+    /**
+     * Load the snapshot if present
+     * @param logOffset Set to the log offset to resume replay from
+     * @return false when there is no snapshot
+     * @throws runtime_error if the snapshot does not match this layout
+     */
+    bool loadSnapshot(uint64_t& logOffset) {
+        FILE* file = fopen(snapshotPath.c_str(), "rb");
+        if (file == nullptr) {
+            return false;
+        }
+        SnapshotHeader header;
+        if (fread(&header, sizeof(header), 1, file) != 1 || header.magic != SNAPSHOT_MAGIC) {
+            fclose(file);
+            throw runtime_error("Corrupt snapshot " + snapshotPath);
+        }
+        if (header.spotCount != spotOccupant.size()) {
+            fclose(file);
+            throw runtime_error("Snapshot spot count does not match the configured layout");
+        }
+        vector<uint64_t> occupied((header.spotCount + 63) / 64);
+        vector<VehicleHandle> occupants(header.occupiedCount);
+        bool ok = fread(occupied.data(), sizeof(uint64_t), occupied.size(), file) == occupied.size() &&
+                  fread(occupants.data(), sizeof(VehicleHandle), occupants.size(), file) == occupants.size();
+        fclose(file);
+        if (!ok) {
+            throw runtime_error("Truncated snapshot " + snapshotPath);
+        }
+
+        // Rebuild free bitmaps bucket by bucket, then place occupants
+        size_t next = 0;
+        for (Bucket& bucket : buckets) {
+            for (uint32_t slot = 0; slot < bucket.slotCount; slot++) {
+                SpotHandle spot = bucket.base + slot;
+                if ((occupied[spot >> 6] >> (spot & 63)) & 1ULL) {
+                    VehicleHandle vehicle = occupants[next++];
+                    spotOccupant[spot] = vehicle;
+                    if (vehicle >= vehicleSpot.size()) {
+                        vehicleSpot.resize(max<size_t>(vehicle + 1, vehicleSpot.size() * 2), NO_HANDLE);
+                    }
+                    vehicleSpot[vehicle] = spot;
+                } else {
+                    bucket.freeSlots.markFree(slot);
+                }
+            }
+        }
+        nextSequence = header.lastSequence + 1;
+        logOffset = header.logOffset;
+        return true;
+    }
+
+    /**
+     * A log record can be applied only if it is the next sequence number and is
+     * consistent with the current occupancy
+     */
+    bool isApplicable(const LogRecord& record) const {
+        SpotHandle spot = record.spot();
+        if (record.sequence != nextSequence || spot >= spotOccupant.size() || record.vehicle == NO_HANDLE) {
+            return false;
+        }
+        if (record.isUnpark()) {
+            return spotOccupant[spot] == record.vehicle;
+        }
+        return spotOccupant[spot] == NO_HANDLE &&
+               (record.vehicle >= vehicleSpot.size() || vehicleSpot[record.vehicle] == NO_HANDLE);
+    }
+
+    /**
+     * Replay the whole log records from a byte offset to wholeEnd
+     * Everything before offset is in the snapshot; every record after it must be
+     * the next sequence number and consistent with occupancy.
+     * @return Number of records applied
+     * @throws runtime_error on the first record that cannot be applied
+     */
+    uint64_t replayLog(uint64_t offset, uint64_t wholeEnd) {
+        if (offset == wholeEnd) {
+            return 0;
+        }
+        FILE* file = fopen(logPath.c_str(), "rb");
+        if (file == nullptr || fseek(file, static_cast<long>(offset), SEEK_SET) != 0) {
+            if (file != nullptr) fclose(file);
+            throw runtime_error("Cannot read occupancy log " + logPath);
+        }
+        vector<LogRecord> chunk(1 << 16);
+        uint64_t applied = 0;
+        uint64_t remaining = (wholeEnd - offset) / sizeof(LogRecord);
+        while (remaining > 0) {
+            size_t want = static_cast<size_t>(min<uint64_t>(remaining, chunk.size()));
+            size_t count = fread(chunk.data(), sizeof(LogRecord), want, file);
+            if (count != want) {
+                fclose(file);
+                throw runtime_error("Short read from occupancy log " + logPath);
+            }
+            for (size_t i = 0; i < count; i++) {
+                const LogRecord& record = chunk[i];
+                if (!isApplicable(record)) {
+                    fclose(file);
+                    throw runtime_error("Corrupt occupancy log record at offset " +
+                                        to_string(offset + (applied * sizeof(LogRecord))));
+                }
+                if (record.isUnpark()) {
+                    applyUnpark(record.vehicle, record.spot());
+                } else {
+                    applyPark(record.vehicle, record.spot());
+                }
+                nextSequence++;
+                applied++;
+            }
+            remaining -= count;
+        }
+        fclose(file);
+        return applied;
+    }
+
+public:
+    /**
+     * Build an empty lot for a layout; call recover() before use
+     * @param layout layout[l] = {motorcycle spots, car spots} on level l
+     * @param directory Where the log and snapshot files live
+     * @param snapshotEvery Automatic snapshot interval in records (0 = manual only)
+     * @throws invalid_argument if layout is empty
+     */
+    DurableParkingLot(const vector<array<uint32_t, SPOT_TYPE_COUNT>>& layout, const string& directory,
+                      uint64_t snapshotEvery, size_t groupCommitSize = 4096, bool durable = false)
+        : levelCount(static_cast<int>(layout.size())),
+          logPath(directory + "/occupancy.log"),
+          snapshotPath(directory + "/occupancy.snapshot"),
+          groupCommitSize(groupCommitSize),
+          durable(durable),
+          snapshotEvery(snapshotEvery) {
+        if (layout.empty()) {
+            throw invalid_argument("Layout must contain at least one level");
+        }
+        buckets.resize(levelCount * SPOT_TYPE_COUNT);
+        SpotHandle next = 0;
+        for (int l = 0; l < levelCount; l++) {
+            for (int t = 0; t < SPOT_TYPE_COUNT; t++) {
+                Bucket& bucket = buckets[l * SPOT_TYPE_COUNT + t];
+                bucket.base = next;
+                bucket.slotCount = layout[l][t];
+                spotBucket.insert(spotBucket.end(), layout[l][t], l * SPOT_TYPE_COUNT + t);
+                next += layout[l][t];
+            }
+        }
+        spotOccupant.assign(next, NO_HANDLE);
+        recover();
+    }
+
+    /**
+     * Rebuild occupancy from the snapshot plus the log tail
+     *
+     * Only a partial trailing record (a write torn by a crash) is cut off, so it
+     * never sits between old records and new appends. A whole record that cannot
+     * be applied is corruption and is left on disk for inspection.
+     * @return Number of log records replayed
+     * @throws runtime_error if the log is corrupt or shorter than the snapshot offset
+     */
+    uint64_t recover() {
+        if (log) {
+            log->commit();
+            log.reset();
+        }
+        resetState();
+        nextSequence = 1;
+        uint64_t offset = 0;
+        if (!loadSnapshot(offset)) {
+            // No snapshot: every slot starts free
+            for (Bucket& bucket : buckets) {
+                for (uint32_t slot = 0; slot < bucket.slotCount; slot++) bucket.freeSlots.markFree(slot);
+            }
+        }
+        error_code error;
+        uint64_t size = filesystem::file_size(logPath, error);
+        if (error) {
+            size = 0;
+        }
+        if (size < offset) {
+            throw runtime_error("Occupancy log " + logPath + " is shorter than the snapshot offset");
+        }
+        uint64_t wholeEnd = offset + (size - offset) / sizeof(LogRecord) * sizeof(LogRecord);
+        uint64_t applied = replayLog(offset, wholeEnd);
+        if (wholeEnd < size) {
+            filesystem::resize_file(logPath, wholeEnd);
+        }
+        log = make_unique<OccupancyLog>(logPath, groupCommitSize, durable);
+        return applied;
+    }
+
+    /**
+     * Park a vehicle in the first free spot (motorcycles prefer motorcycle spots)
+     * @return Spot handle, or NO_HANDLE if the lot is full
+     * @throws runtime_error if the vehicle is already parked
+     */
+    SpotHandle park(VehicleHandle vehicle, VehicleType type) {
+        if (vehicle < vehicleSpot.size() && vehicleSpot[vehicle] != NO_HANDLE) {
+            throw runtime_error("Vehicle handle " + to_string(vehicle) + " is already parked");
+        }
+        SpotHandle spot = NO_HANDLE;
+        switch (type) {
+            case VehicleType::MOTORCYCLE:
+                spot = findOfType(SpotType::MOTORCYCLE);
+                if (spot == NO_HANDLE) spot = findOfType(SpotType::CAR);
+                break;
+            case VehicleType::CAR:
+                spot = findOfType(SpotType::CAR);
+                break;
+            default:
+                // Unknown vehicle type - extensible for future vehicle types
+                break;
+        }
+        if (spot == NO_HANDLE) {
+            return NO_HANDLE;
+        }
+        logEvent(vehicle, spot, false);
+        applyPark(vehicle, spot);
+        snapshotIfDue();
+        return spot;
+    }
+
+    /**
+     * @throws runtime_error if the vehicle is not parked
+     */
+    void unpark(VehicleHandle vehicle) {
+        if (vehicle >= vehicleSpot.size() || vehicleSpot[vehicle] == NO_HANDLE) {
+            throw runtime_error("Vehicle handle " + to_string(vehicle) + " is not parked");
+        }
+        SpotHandle spot = vehicleSpot[vehicle];
+        logEvent(vehicle, spot, true);
+        applyUnpark(vehicle, spot);
+        snapshotIfDue();
+    }
+
+    /**
+     * Force pending log records to disk (end of a group commit window)
+     */
+    void commit() { log->commit(); }
+
+    /**
+     * Write a compact occupancy snapshot atomically (temp file + rename)
+     * Commits the log first so the recorded offset covers every applied event.
+     * The file and then its directory are fsynced, so a snapshot that recovery
+     * can see is always fully on disk.
+     * @throws runtime_error if the snapshot cannot be written or synced
+     */
+    void writeSnapshot() {
+        log->commit();
+        vector<uint64_t> occupied((spotOccupant.size() + 63) / 64, 0);
+        vector<VehicleHandle> occupants;
+        for (SpotHandle s = 0; s < spotOccupant.size(); s++) {
+            if (spotOccupant[s] != NO_HANDLE) {
+                occupied[s >> 6] |= 1ULL << (s & 63);
+                occupants.push_back(spotOccupant[s]);
+            }
+        }
+        SnapshotHeader header{SNAPSHOT_MAGIC, nextSequence - 1, log->getCommittedBytes(),
+                              spotOccupant.size(), occupants.size()};
+
+        string tempPath = snapshotPath + ".tmp";
+        FILE* file = fopen(tempPath.c_str(), "wb");
+        if (file == nullptr) {
+            throw runtime_error("Cannot write snapshot " + tempPath);
+        }
+        bool ok = fwrite(&header, sizeof(header), 1, file) == 1 &&
+                  fwrite(occupied.data(), sizeof(uint64_t), occupied.size(), file) == occupied.size() &&
+                  fwrite(occupants.data(), sizeof(VehicleHandle), occupants.size(), file) == occupants.size() &&
+                  fflush(file) == 0 && fsync(fileno(file)) == 0;
+        ok = fclose(file) == 0 && ok;
+        if (!ok || rename(tempPath.c_str(), snapshotPath.c_str()) != 0) {
+            throw runtime_error("Failed to write snapshot " + snapshotPath);
+        }
+        syncDirectory(snapshotPath);
+        recordsSinceSnapshot = 0;
+    }
+
+    VehicleHandle getVehicleInSpot(SpotHandle spot) const { return spotOccupant[spot]; }
+    SpotHandle getSpotOfVehicle(VehicleHandle vehicle) const {
+        return vehicle < vehicleSpot.size() ? vehicleSpot[vehicle] : NO_HANDLE;
+    }
+    size_t getSpotCount() const { return spotOccupant.size(); }
+    uint32_t getFreeCount(int level, SpotType type) const {
+        return buckets[level * SPOT_TYPE_COUNT + static_cast<int>(type)].freeSlots.getFreeCount();
+    }
+};
+
+namespace UnitTests {
+    void check(bool condition, const string& message) {
+        cout << (condition ? "✓ " : "✗ ") << message << endl;
+    }
+
+    string freshDirectory(const string& name) {
+        string directory = "/tmp/parkinglot_" + name;
+        filesystem::remove_all(directory);
+        filesystem::create_directories(directory);
+        return directory;
+    }
+
+    bool sameOccupancy(const DurableParkingLot& a, const DurableParkingLot& b, size_t vehicles) {
+        for (SpotHandle s = 0; s < a.getSpotCount(); s++) {
+            if (a.getVehicleInSpot(s) != b.getVehicleInSpot(s)) return false;
+        }
+        for (VehicleHandle v = 0; v < vehicles; v++) {
+            if (a.getSpotOfVehicle(v) != b.getSpotOfVehicle(v)) return false;
+        }
+        return true;
+    }
+
+    void testRecovery() {
+        cout << "\n=== Testing Recovery ===" << endl;
+        string directory = freshDirectory("recovery_test");
+        vector<array<uint32_t, SPOT_TYPE_COUNT>> layout = {{50, 150}, {20, 300}};
+        const size_t vehicles = 600;
+        mt19937 rng(3);
+
+        auto live = make_unique<DurableParkingLot>(layout, directory, 1000, 64);
+        for (int step = 0; step < 5000; step++) {
+            VehicleHandle v = rng() % vehicles;
+            VehicleType type = v % 3 == 0 ? VehicleType::MOTORCYCLE : VehicleType::CAR;
+            if (live->getSpotOfVehicle(v) == NO_HANDLE) live->park(v, type);
+            else live->unpark(v);
+        }
+        live->commit();
+
+        DurableParkingLot recovered(layout, directory, 0);
+        check(sameOccupancy(*live, recovered, vehicles), "Snapshot + log tail reproduces occupancy");
+        check(recovered.getFreeCount(1, SpotType::CAR) == live->getFreeCount(1, SpotType::CAR),
+              "Free bitmaps are rebuilt from occupancy");
+
+        filesystem::remove(directory + "/occupancy.snapshot");
+        DurableParkingLot fromLogOnly(layout, directory, 0);
+        check(sameOccupancy(*live, fromLogOnly, vehicles), "Full log replay without snapshot matches");
+
+        // A torn trailing record from a crash mid-write is ignored
+        live.reset();
+        FILE* file = fopen((directory + "/occupancy.log").c_str(), "ab");
+        fwrite("torn", 1, 4, file);
+        fclose(file);
+        auto afterTear = make_unique<DurableParkingLot>(layout, directory, 0, 64);
+        check(sameOccupancy(fromLogOnly, *afterTear, vehicles), "Torn trailing record is skipped");
+        check(filesystem::file_size(directory + "/occupancy.log") % sizeof(LogRecord) == 0,
+              "Recovery truncates the torn tail");
+
+        // Records appended after the tear stay on the record boundary
+        for (int step = 0; step < 3000; step++) {
+            VehicleHandle v = rng() % vehicles;
+            VehicleType type = v % 3 == 0 ? VehicleType::MOTORCYCLE : VehicleType::CAR;
+            if (afterTear->getSpotOfVehicle(v) == NO_HANDLE) afterTear->park(v, type);
+            else afterTear->unpark(v);
+        }
+        afterTear->commit();
+        filesystem::remove(directory + "/occupancy.snapshot");
+        DurableParkingLot replayedAfterTear(layout, directory, 0);
+        check(sameOccupancy(*afterTear, replayedAfterTear, vehicles), "Full log replay after a tear and new appends matches");
+
+        // A whole but invalid record is corruption: recovery fails and keeps the log
+        afterTear.reset();
+        string logPath = directory + "/occupancy.log";
+        auto appendRecord = [&](const LogRecord& record) {
+            FILE* file = fopen(logPath.c_str(), "ab");
+            fwrite(&record, sizeof(record), 1, file);
+            fclose(file);
+        };
+        auto recoveryFails = [&]() {
+            try {
+                DurableParkingLot corrupt(layout, directory, 0);
+                return false;
+            } catch (const runtime_error&) {
+                return true;
+            }
+        };
+        uint64_t goodSize = filesystem::file_size(logPath);
+        uint64_t nextRecord = goodSize / sizeof(LogRecord) + 1;
+        appendRecord({nextRecord, 7, 0x7FFFFFF0u});
+        appendRecord({nextRecord + 1, 8, 0});
+        check(recoveryFails(), "Record with an out-of-range spot is reported as corruption");
+        check(filesystem::file_size(logPath) == goodSize + 2 * sizeof(LogRecord),
+              "Corrupt record and the records after it are not truncated");
+
+        filesystem::resize_file(logPath, goodSize);
+        appendRecord({0, 0, 0});
+        check(recoveryFails(), "Zero-filled record is not mistaken for one already in the snapshot");
+
+        filesystem::resize_file(logPath, goodSize);
+        DurableParkingLot afterRepair(layout, directory, 0);
+        check(sameOccupancy(replayedAfterTear, afterRepair, vehicles), "Recovery succeeds once the log is repaired");
+
+        // Snapshot records its byte offset: the tail after it is replayed by offset
+        afterRepair.writeSnapshot();
+        appendRecord({0, 0, 0});
+        check(recoveryFails(), "Garbage after the snapshot offset is reported as corruption");
+        filesystem::resize_file(logPath, goodSize);
+
+        try {
+            afterRepair.unpark(vehicles + 10);
+            check(false, "Should have thrown exception for vehicle that is not parked");
+        } catch (const runtime_error& e) {
+            check(true, string("Correctly caught exception for vehicle that is not parked: ") + e.what());
+        }
+        filesystem::remove_all(directory);
+    }
+
+    void runAllTests() {
+        testRecovery();
+    }
+}
+
+namespace Benchmark {
+    /**
+     * Log write throughput, then recovery time from snapshot + tail
+     */
+    void runLogAndRecovery(int levels, uint32_t spotsPerLevel, uint64_t events, uint64_t tailEvents) {
+        string directory = UnitTests::freshDirectory("recovery_bench");
+        vector<array<uint32_t, SPOT_TYPE_COUNT>> layout(levels, {spotsPerLevel / 4, spotsPerLevel - spotsPerLevel / 4});
+        size_t spotCount = static_cast<size_t>(levels) * spotsPerLevel;
+        size_t vehicles = spotCount * 3 / 4;
+        mt19937 rng(11);
+        {
+            DurableParkingLot lot(layout, directory, 0, 8192);
+            auto start = chrono::steady_clock::now();
+            for (uint64_t i = 0; i < events; i++) {
+                VehicleHandle v = rng() % vehicles;
+                if (lot.getSpotOfVehicle(v) == NO_HANDLE) lot.park(v, v % 4 == 0 ? VehicleType::MOTORCYCLE : VehicleType::CAR);
+                else lot.unpark(v);
+            }
+            lot.commit();
+            double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+            cout << "Log write: " << events << " events, " << static_cast<long long>(events / seconds)
+                 << " events/sec (group commit 8192, no fsync)" << endl;
+
+            auto snapStart = chrono::steady_clock::now();
+            lot.writeSnapshot();
+            cout << "Snapshot of " << spotCount << " spots: "
+                 << chrono::duration<double, milli>(chrono::steady_clock::now() - snapStart).count() << " ms" << endl;
+
+            for (uint64_t i = 0; i < tailEvents; i++) {
+                VehicleHandle v = rng() % vehicles;
+                if (lot.getSpotOfVehicle(v) == NO_HANDLE) lot.park(v, VehicleType::CAR);
+                else lot.unpark(v);
+            }
+        }
+
+        auto start = chrono::steady_clock::now();
+        DurableParkingLot recovered(layout, directory, 0);
+        double ms = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+        cout << "Recovery of " << spotCount << " spots (snapshot + " << tailEvents << " tail events): "
+             << ms << " ms" << endl;
+        filesystem::remove_all(directory);
+    }
+}
+
+int main() {
+    UnitTests::runAllTests();
+
+    cout << "\n=== Benchmark ===" << endl;
+    Benchmark::runLogAndRecovery(10, 500000, 10000000, 1000000);
+    return 0;
+}
+
+/*
+===================================================================
+                    PROBLEM DESCRIPTION
+===================================================================
+
+Same problem as ParkingLot.cpp, plus crash recovery: after a restart the
+vehicle -> spot map and every level's free-spot sets must be rebuilt
+quickly, without replaying the whole history of calls.
+
+APPROACH:
+- Event log: every park/unpark appends a 16-byte LogRecord
+  {sequence, vehicle, spot | unpark-bit}. Records are buffered and written
+  as one group (one fwrite + fflush, optional fsync) per batch.
+- Snapshot: header {lastSequence, logOffset, spotCount, occupiedCount},
+  the occupancy bitmap (1 bit per spot) and the occupant handle of each
+  occupied spot in handle order. Written to a temp file and renamed, so a
+  crash mid-snapshot keeps the previous snapshot.
+- Recovery: load the snapshot, rebuild each (level, SpotType) free bitmap
+  from the occupancy bitmap, then seek the log to logOffset and replay the
+  tail. Records before logOffset are in the snapshot; every record after
+  it must carry the next sequence number and be consistent with occupancy
+  (spot in range, unpark of the vehicle at that spot). A partial trailing
+  record from a crash mid-write is truncated before new records are
+  appended; a whole record that fails these checks aborts recovery as
+  corruption and is left on disk.
+- Park / unpark append the event before changing occupancy, so a failed
+  group commit never leaves memory ahead of the log.
+
+TIME COMPLEXITY:
+- Park / Unpark: O(L) + amortized O(1) log append
+- Snapshot: O(S)
+- Recovery: O(S + tail records)
+
+SPACE ON DISK:
+- Snapshot: S / 8 + 4 * occupied bytes
+- Log: 16 bytes per event (can be truncated up to logOffset after a snapshot)
+*/
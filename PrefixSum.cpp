@@ -0,0 +1,164 @@
+#include<bits/stdc++.h>
+#include "PrefixSum.h"
+using namespace std;
+
+/**
+ * The serial scatter + prefix sum solveLinear used to run (HauntedHouse.cpp),
+ * kept here as the benchmark baseline
+ */
+vector<int> serialCounts(size_t size, const vector<pair<int, int>>& ranges) {
+    vector<int> diff(size + 1, 0);
+    for (const auto& range : ranges) {
+        long long lo = max<long long>(0, range.first);
+        long long hi = min<long long>((long long)size - 1, range.second);
+        if (lo > hi) continue;
+        diff[lo]++;
+        diff[hi + 1]--;
+    }
+    vector<int> count(size);
+    int running = 0;
+    for (size_t i = 0; i < size; i++) {
+        running += diff[i];
+        count[i] = running;
+    }
+    return count;
+}
+
+vector<pair<int, int>> randomRanges(size_t count, int size, unsigned seed) {
+    mt19937 rng(seed);
+    vector<pair<int, int>> ranges(count);
+    for (auto& range : ranges) {
+        int lo = (int)(rng() % (size + 20)) - 10;
+        range = {lo, lo + (int)(rng() % (size / 2 + 1)) - 2};
+    }
+    return ranges;
+}
+
+double elapsedMs(chrono::steady_clock::time_point start) {
+    return chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+}
+
+void benchmarkScan(size_t n, unsigned threads) {
+    vector<int> data(n), copy;
+    mt19937 rng(1);
+    for (int& x : data) x = (int)(rng() % 7) - 3;
+
+    copy = data;
+    auto start = chrono::steady_clock::now();
+    int running = 0;
+    for (size_t i = 0; i < n; i++) {
+        running += copy[i];
+        copy[i] = running;
+    }
+    double serialMs = elapsedMs(start);
+    vector<int> expected = copy;
+
+    copy = data;
+    start = chrono::steady_clock::now();
+    prefix_sum::scanBlock(copy.data(), n);
+    double simdMs = elapsedMs(start);
+    assert(copy == expected);
+
+    copy = data;
+    start = chrono::steady_clock::now();
+    prefix_sum::inclusiveScan(copy.data(), n, threads);
+    double parallelMs = elapsedMs(start);
+    assert(copy == expected);
+
+    cout << "Prefix sum, " << n / 1000000 << "M ints:\n";
+    cout << "  Serial loop:           " << serialMs << " ms\n";
+    cout << "  SSE2 block scan:       " << simdMs << " ms\n";
+    cout << "  Two-pass, " << threads << " threads:   " << parallelMs << " ms\n";
+}
+
+void benchmarkCounts(size_t size, size_t rangeCount, unsigned threads) {
+    vector<pair<int, int>> ranges = randomRanges(rangeCount, (int)size, 5);
+
+    auto start = chrono::steady_clock::now();
+    vector<int> expected = serialCounts(size, ranges);
+    double serialMs = elapsedMs(start);
+
+    start = chrono::steady_clock::now();
+    prefix_sum::DifferenceArray diff(size, threads);
+    diff.addRanges(ranges.data(), ranges.size());
+    vector<int> counts = diff.counts();
+    double kernelMs = elapsedMs(start);
+    assert(counts == expected);
+
+    cout << "Range counts, " << rangeCount / 1000000 << "M ranges over " << size / 1000000 << "M positions:\n";
+    cout << "  Serial scatter + scan: " << serialMs << " ms\n";
+    cout << "  Kernel, " << diff.threads() << " threads:     " << kernelMs << " ms\n";
+}
+
+int main() {
+    // scanBlock: every length around the 4-lane boundary, with a carry
+    for (size_t n = 0; n < 40; n++) {
+        vector<int> data(n), expected(n);
+        for (size_t i = 0; i < n; i++) data[i] = (int)(i * 7 % 11) - 5;
+        int running = 100;
+        for (size_t i = 0; i < n; i++) expected[i] = running += data[i];
+        assert(prefix_sum::scanBlock(data.data(), n, 100) == running);
+        assert(data == expected);
+    }
+    cout << "scanBlock tests passed!\n";
+
+    // inclusiveScan: chunk boundaries with more threads than chunks and uneven splits
+    for (size_t n : {(size_t)0, (size_t)1, prefix_sum::MIN_PARALLEL_CHUNK * 3 + 5, prefix_sum::MIN_PARALLEL_CHUNK * 8 - 1}) {
+        for (unsigned threads : {1u, 2u, 3u, 8u}) {
+            vector<int> data(n), expected(n);
+            for (size_t i = 0; i < n; i++) data[i] = (int)(i % 5) - 2;
+            int running = 0;
+            for (size_t i = 0; i < n; i++) expected[i] = running += data[i];
+            prefix_sum::inclusiveScan(data.data(), n, threads);
+            assert(data == expected);
+        }
+    }
+    cout << "inclusiveScan tests passed!\n";
+
+    // DifferenceArray: clipping, empty ranges, several batches, memory-capped threads
+    for (unsigned threads : {1u, 2u, 4u}) {
+        for (size_t budget : {(size_t)0, (size_t)1 << 30}) {
+            size_t size = 300000;
+            vector<pair<int, int>> ranges = randomRanges(500000, (int)size, threads);
+            ranges.push_back({5, 4});
+            ranges.push_back({-50, -1});
+            ranges.push_back({(int)size, (int)size + 9});
+            prefix_sum::DifferenceArray diff(size, threads, budget);
+            assert(diff.threads() == (budget == 0 ? 1 : threads));
+            size_t half = ranges.size() / 2;
+            diff.addRanges(ranges.data(), half);
+            diff.addRanges(ranges.data() + half, ranges.size() - half);
+            assert(diff.counts() == serialCounts(size, ranges));
+        }
+    }
+    cout << "DifferenceArray tests passed!\n\n";
+
+    unsigned threads = max(2u, thread::hardware_concurrency());
+    cout << "Hardware threads: " << thread::hardware_concurrency() << ", benchmarking with " << threads << "\n";
+    benchmarkScan(200000000, threads);
+    benchmarkCounts(100000000, 50000000, threads);
+    return 0;
+}
+
+/*
+Problem Summary:
+solveLinear (HauntedHouse.cpp) scatters +1/-1 into a difference array and then runs
+a serial prefix sum. Both passes are memory-bound and single-core, which dominates
+at hundreds of millions of constraints. PrefixSum.h is a reusable kernel for this
+pattern.
+
+Kernel:
+- scanBlock: SSE2 in-register scan. x += x << 1 lane, x += x << 2 lanes, add the
+  running carry, broadcast the last lane as the next carry.
+- inclusiveScan: blocked two-pass parallel scan. Threads sum their chunks, the
+  chunk totals are scanned serially, then threads scan their chunks from their
+  offsets.
+- DifferenceArray: per-thread local difference arrays (no shared writes while
+  scattering), merged by position slices, then scanned. The number of local arrays
+  is capped by a memory budget, because each costs a full array.
+
+Complexity:
+- inclusiveScan: O(n / threads + threads)
+- DifferenceArray: O(ranges / threads) scatter + O(size * locals / threads) merge
+  + scan
+*/
@@ -0,0 +1,211 @@
+#pragma once
+
+#include <vector>
+#include <thread>
+#include <algorithm>
+#include <utility>
+#include <cstddef>
+#include <cstdint>
+#include <cassert>
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+/**
+ * Header-only difference-array / prefix-sum kernel shared across modules
+ *
+ * - inclusiveScan:   in-place prefix sum. Blocks are scanned with SSE2 (4 lanes per
+ *                    register); large arrays use a blocked two-pass parallel scan.
+ * - DifferenceArray: accumulates +1 range updates into per-thread local difference
+ *                    arrays, then merges them and scans them into counts.
+ *
+ * Both are memory-bound, so the parallel paths only help when every thread gets a
+ * chunk well beyond the caches; small inputs take the single-thread path.
+ *
+ * See PrefixSum.cpp for tests and benchmarks.
+ */
+
+namespace prefix_sum {
+
+/**
+ * Chunks below this many elements per thread are scanned by one thread
+ */
+constexpr size_t MIN_PARALLEL_CHUNK = 1 << 16;
+
+/**
+ * Inclusive scan of data[0..n) starting from carry, on one thread
+ *
+ * Per 4-lane register x: x += x << 1 lane; x += x << 2 lanes; x += carry, then the
+ * last lane becomes the carry for the next register.
+ * @return: carry + sum of data[0..n)
+ */
+inline int scanBlock(int* data, size_t n, int carry = 0) {
+    size_t i = 0;
+#if defined(__SSE2__)
+    __m128i offset = _mm_set1_epi32(carry);
+    for (; i + 4 <= n; i += 4) {
+        __m128i x = _mm_loadu_si128((const __m128i*)(data + i));
+        x = _mm_add_epi32(x, _mm_slli_si128(x, 4));
+        x = _mm_add_epi32(x, _mm_slli_si128(x, 8));
+        x = _mm_add_epi32(x, offset);
+        _mm_storeu_si128((__m128i*)(data + i), x);
+        offset = _mm_shuffle_epi32(x, 0xFF);
+    }
+    carry = _mm_cvtsi128_si32(offset);
+#endif
+    for (; i < n; i++) {
+        carry += data[i];
+        data[i] = carry;
+    }
+    return carry;
+}
+
+inline int sumBlock(const int* data, size_t n) {
+    int total = 0;
+    for (size_t i = 0; i < n; i++) total += data[i];
+    return total;
+}
+
+/**
+ * Runs body(t, begin, end) on `threads` threads over equal chunks of [0, n)
+ */
+template <class Body>
+void parallelChunks(size_t n, unsigned threads, Body body) {
+    std::vector<std::thread> workers;
+    size_t chunk = (n + threads - 1) / threads;
+    for (unsigned t = 1; t < threads; t++) {
+        size_t begin = std::min(n, t * chunk), end = std::min(n, begin + chunk);
+        workers.emplace_back(body, t, begin, end);
+    }
+    body(0u, (size_t)0, std::min(n, chunk));
+    for (std::thread& worker : workers) worker.join();
+}
+
+inline unsigned usableThreads(size_t n, unsigned threads) {
+    return (unsigned)std::max<size_t>(1, std::min<size_t>(threads, n / MIN_PARALLEL_CHUNK));
+}
+
+/**
+ * In-place inclusive prefix sum of data[0..n)
+ *
+ * Blocked two-pass scan: every thread sums its chunk, the per-chunk totals are
+ * scanned serially into chunk offsets, then every thread scans its chunk from its
+ * offset. Two reads and one write per element, independent of the thread count.
+ *
+ * Time Complexity: O(n / threads + threads)
+ */
+inline void inclusiveScan(int* data, size_t n, unsigned threads = 1) {
+    threads = usableThreads(n, threads);
+    if (threads == 1) {
+        scanBlock(data, n);
+        return;
+    }
+    std::vector<int> offsets(threads, 0);
+    parallelChunks(n, threads, [&](unsigned t, size_t begin, size_t end) {
+        offsets[t] = sumBlock(data + begin, end - begin);
+    });
+    int carry = 0;
+    for (unsigned t = 0; t < threads; t++) {
+        int total = offsets[t];
+        offsets[t] = carry;
+        carry += total;
+    }
+    parallelChunks(n, threads, [&](unsigned t, size_t begin, size_t end) {
+        scanBlock(data + begin, end - begin, offsets[t]);
+    });
+}
+
+/**
+ * Counts of overlapping ranges over positions 0..size-1
+ *
+ * addRanges splits each batch across threads; thread t marks +1 at lo and -1 at
+ * hi + 1 in its own local difference array, so there are no shared writes. counts()
+ * merges the locals (each thread owning a slice of positions) and scans.
+ *
+ * Each extra thread needs its own size-element array, so the thread count for
+ * addRanges is capped by a memory budget; with one thread the ranges go straight
+ * into the result. The merge and scan always use every requested thread.
+ */
+class DifferenceArray {
+private:
+    size_t size;
+    unsigned requestedThreads;
+    unsigned scatterThreads;
+    std::vector<std::vector<int>> locals;  // locals[0] becomes the result
+
+public:
+    /**
+     * @param localBudgetBytes: memory allowed for the extra per-thread arrays
+     */
+    DifferenceArray(size_t size, unsigned threads = 1, size_t localBudgetBytes = size_t(1) << 31)
+        : size(size), requestedThreads(std::max(1u, threads)) {
+        size_t affordable = 1 + localBudgetBytes / std::max<size_t>(1, (size + 1) * sizeof(int));
+        scatterThreads = (unsigned)std::max<size_t>(1, std::min<size_t>(threads, affordable));
+        locals.resize(scatterThreads);
+        for (std::vector<int>& local : locals) local.assign(size + 1, 0);
+    }
+
+    /**
+     * Threads used by addRanges
+     */
+    unsigned threads() const {
+        return scatterThreads;
+    }
+
+    /**
+     * Adds 1 to every position of rangeOf(items[i]) = inclusive [lo, hi], for each
+     * item, clipped to [0, size); empty ranges are skipped
+     */
+    template <class Item, class RangeOf>
+    void addRanges(const Item* items, size_t count, RangeOf rangeOf) {
+        assert(!locals.empty() && "counts() already consumed the ranges");
+        auto mark = [&](unsigned t, size_t begin, size_t end) {
+            int* diff = locals[t].data();
+            const long long last = (long long)size - 1;
+            for (size_t i = begin; i < end; i++) {
+                std::pair<int, int> range = rangeOf(items[i]);
+                long long lo = std::max<long long>(0, range.first);
+                long long hi = std::min<long long>(last, range.second);
+                if (lo > hi) continue;
+                diff[lo]++;
+                diff[hi + 1]--;
+            }
+        };
+        unsigned used = std::min<unsigned>(threads(), usableThreads(count, threads()));
+        if (used == 1) {
+            mark(0, 0, count);
+        } else {
+            parallelChunks(count, used, mark);
+        }
+    }
+
+    void addRanges(const std::pair<int, int>* ranges, size_t count) {
+        addRanges(ranges, count, [](const std::pair<int, int>& range) { return range; });
+    }
+
+    /**
+     * Merges the per-thread arrays and returns count[0..size); consumes the ranges,
+     * so it is called once
+     *
+     * Time Complexity: O(size * threads() / requested threads)
+     */
+    std::vector<int> counts() {
+        assert(!locals.empty() && "counts() already consumed the ranges");
+        std::vector<int> result;
+        result.swap(locals[0]);
+        if (locals.size() > 1) {
+            parallelChunks(size, usableThreads(size, requestedThreads), [&](unsigned, size_t begin, size_t end) {
+                for (size_t t = 1; t < locals.size(); t++) {
+                    const int* local = locals[t].data();
+                    for (size_t i = begin; i < end; i++) result[i] += local[i];
+                }
+            });
+        }
+        locals.clear();
+        result.pop_back();  // The hi + 1 == size slot
+        inclusiveScan(result.data(), size, requestedThreads);
+        return result;
+    }
+};
+
+}  // namespace prefix_sum
@@ -0,0 +1,486 @@
+/**
+ * ================================================================================
+ * Schedule Creator - Allocation-Free Datetime Parsing
+ * ================================================================================
+ *
+ * Parses "YYYY-MM-DD HH" timestamps straight from string_view with SWAR digit
+ * arithmetic and converts them with an exact proleptic-Gregorian calendar, for the
+ * Part 2 membership checks over large log files.
+ * ================================================================================
+ */
+
+#include <iostream>
+#include <vector>
+#include <string>
+#include <string_view>
+#include <random>
+#include <chrono>
+#include <algorithm>
+#include <stdexcept>
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+#include <cstdio>
+#include <tuple>
+
+/**
+ * ================================================================================
+ * BASELINE (same as ScheduleCreation.cpp)
+ * ================================================================================
+ */
+
+struct ScheduleSettings {
+    std::string start_date;              // "YYYY-MM-DD" format
+    std::string end_date;                // "YYYY-MM-DD" format
+    int interval_window_size_hours;      // Hours per ON/OFF cycle
+};
+
+struct TimeInterval {
+    int start_hour;  // Hours from start_date
+    int end_hour;    // Hours from start_date
+
+    TimeInterval(int start, int end) : start_hour(start), end_hour(end) {}
+};
+
+int calculateDays(const std::string& start_date, const std::string& end_date) {
+    int start_day = std::stoi(start_date.substr(8, 2));
+    int end_day = std::stoi(end_date.substr(8, 2));
+    return end_day - start_day + 1;
+}
+
+int dateTimeToHour(const std::string& datetime, const std::string& start_date) {
+    int dt_year = std::stoi(datetime.substr(0, 4));
+    int dt_month = std::stoi(datetime.substr(5, 2));
+    int dt_day = std::stoi(datetime.substr(8, 2));
+    int dt_hour = std::stoi(datetime.substr(11, 2));
+
+    int start_year = std::stoi(start_date.substr(0, 4));
+    int start_month = std::stoi(start_date.substr(5, 2));
+    int start_day = std::stoi(start_date.substr(8, 2));
+
+    int year_diff = dt_year - start_year;
+    int month_diff = dt_month - start_month;
+    int day_diff = dt_day - start_day;
+
+    int total_day_offset = year_diff * 365 + month_diff * 30 + day_diff;
+    return total_day_offset * 24 + dt_hour;
+}
+
+bool isTimestampIncluded_Binary(const std::vector<TimeInterval>& scheduleIntervals, int timestamp_hour) {
+    int left = 0;
+    int right = scheduleIntervals.size() - 1;
+    while (left <= right) {
+        int mid = left + (right - left) / 2;
+        const auto& interval = scheduleIntervals[mid];
+        if (timestamp_hour >= interval.start_hour && timestamp_hour < interval.end_hour) {
+            return true;
+        } else if (timestamp_hour < interval.start_hour) {
+            right = mid - 1;
+        } else {
+            left = mid + 1;
+        }
+    }
+    return false;
+}
+
+/**
+ * ================================================================================
+ * PROLEPTIC-GREGORIAN CALENDAR
+ * ================================================================================
+ */
+
+/**
+ * @brief Days since 1970-01-01 for a proleptic-Gregorian date
+ *
+ * Shifts the year to start in March so the leap day is the last day of the year,
+ * then counts whole 400-year eras (146097 days each) plus the day of the era.
+ *
+ * Time Complexity: O(1)
+ * Space Complexity: O(1)
+ */
+constexpr long long daysFromCivil(int year, int month, int day) {
+    year -= month <= 2;
+    const long long era = (year >= 0 ? year : year - 399) / 400;
+    const int yearOfEra = (int)(year - era * 400);                                // [0, 399]
+    const int dayOfYear = (153 * (month + (month > 2 ? -3 : 9)) + 2) / 5 + day - 1;  // [0, 365]
+    const int dayOfEra = yearOfEra * 365 + yearOfEra / 4 - yearOfEra / 100 + dayOfYear;
+    return era * 146097 + dayOfEra - 719468;
+}
+
+static_assert(daysFromCivil(1970, 1, 1) == 0, "Unix epoch");
+static_assert(daysFromCivil(2000, 3, 1) - daysFromCivil(2000, 2, 28) == 2, "2000 is a leap year");
+static_assert(daysFromCivil(2100, 3, 1) - daysFromCivil(2100, 2, 28) == 1, "2100 is not a leap year");
+
+constexpr int daysInMonth(int year, int month) {
+    return month == 2 ? ((year % 4 == 0 && (year % 100 != 0 || year % 400 == 0)) ? 29 : 28)
+                      : 30 + ((month + (month >> 3)) & 1);
+}
+
+/**
+ * ================================================================================
+ * SWAR PARSING
+ * ================================================================================
+ */
+
+namespace swar {
+
+inline uint64_t load8(const char* p) {
+    uint64_t word;
+    std::memcpy(&word, p, 8);
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    word = __builtin_bswap64(word);
+#endif
+    return word;
+}
+
+/**
+ * @brief True when every byte selected by mask is an ASCII digit
+ *
+ * A digit has high nibble 3, and adding 6 must not carry it into 4 ('9' + 6 = '?').
+ * Bytes outside the mask are ignored.
+ */
+inline bool allDigits(uint64_t word, uint64_t mask) {
+    const uint64_t nibbles = 0xF0F0F0F0F0F0F0F0ull & mask;
+    const uint64_t threes = 0x3030303030303030ull & mask;
+    return (word & nibbles) == threes && ((word + 0x0606060606060606ull) & nibbles) == threes;
+}
+
+/**
+ * @brief Digit pairs at even byte offsets to their two-digit values
+ *
+ * Byte 2k of the result holds 10 * digit[2k] + digit[2k+1].
+ */
+inline uint64_t pairValues(uint64_t word) {
+    uint64_t digits = word - 0x3030303030303030ull;
+    return (digits * 10 + (digits >> 8)) & 0x00FF00FF00FF00FFull;
+}
+
+}  // namespace swar
+
+/**
+ * @brief Calendar fields of a "YYYY-MM-DD HH" timestamp
+ */
+struct CivilHour {
+    int year;
+    int month;
+    int day;
+    int hour;
+};
+
+/**
+ * @brief Parses "YYYY-MM-DD" or "YYYY-MM-DD HH..." without allocating
+ *
+ * Reads the leading 8 bytes ("YYYY-MM-") as one word and, for the hour form, the
+ * word at offset 5 ("MM-DD HH"), which is realigned so MM, DD and HH sit at even
+ * byte offsets. Digits and separators are validated with whole-word masks, and
+ * each word is turned into pair values with one multiply. Anything after the hour
+ * (":00:00") is ignored; month, day and hour are range-checked.
+ *
+ * @return false on malformed input
+ */
+inline bool parseCivilHour(std::string_view text, CivilHour& out, bool withHour = true) {
+    if (text.size() < (withHour ? 13u : 10u)) return false;
+    const char* p = text.data();
+
+    uint64_t head = swar::load8(p);  // Y Y Y Y - M M -
+    if (!swar::allDigits(head, 0x00FFFF00FFFFFFFFull) ||
+        (head & 0xFF0000FF00000000ull) != 0x2D00002D00000000ull) {
+        return false;
+    }
+    uint64_t yearPairs = swar::pairValues(head);
+    out.year = (int)(yearPairs & 0xFF) * 100 + (int)((yearPairs >> 16) & 0xFF);
+
+    uint64_t fields;  // M M D D H H at byte offsets 0..5
+    if (withHour) {
+        uint64_t tail = swar::load8(p + 5);  // M M - D D ' ' H H
+        if ((tail & 0x0000FF0000FF0000ull) != 0x00002000002D0000ull) return false;
+        fields = (tail & 0xFFFF) | ((tail >> 8) & 0xFFFF0000ull) | ((tail >> 16) & 0xFFFF00000000ull);
+        if (!swar::allDigits(fields, 0x0000FFFFFFFFFFFFull)) return false;
+    } else {
+        uint16_t dd;
+        std::memcpy(&dd, p + 8, 2);
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+        dd = __builtin_bswap16(dd);
+#endif
+        fields = ((head >> 40) & 0xFFFF) | ((uint64_t)dd << 16) | 0x303000000000ull;
+        if (!swar::allDigits(fields, 0x0000FFFFFFFFFFFFull)) return false;
+    }
+    uint64_t pairs = swar::pairValues(fields);
+    out.month = (int)(pairs & 0xFF);
+    out.day = (int)((pairs >> 16) & 0xFF);
+    out.hour = (int)((pairs >> 32) & 0xFF);
+
+    return out.month >= 1 && out.month <= 12 && out.day >= 1 &&
+           out.day <= daysInMonth(out.year, out.month) && out.hour <= 23;
+}
+
+/**
+ * @brief Days since 1970-01-01 of a "YYYY-MM-DD" date
+ *
+ * @throws std::invalid_argument on malformed input
+ */
+inline long long epochDay(std::string_view date) {
+    CivilHour civil;
+    if (!parseCivilHour(date, civil, false)) {
+        throw std::invalid_argument("Expected YYYY-MM-DD: " + std::string(date));
+    }
+    return daysFromCivil(civil.year, civil.month, civil.day);
+}
+
+/**
+ * @brief Inclusive day count between two dates, across months and years
+ *
+ * Time Complexity: O(1)
+ */
+int calculateDaysCivil(std::string_view start_date, std::string_view end_date) {
+    return (int)(epochDay(end_date) - epochDay(start_date) + 1);
+}
+
+/**
+ * @brief Hour offsets from a fixed start date, parsed without allocation
+ *
+ * The start date is converted once; each timestamp then costs one SWAR parse and
+ * one days-from-civil conversion.
+ */
+class HourParser {
+private:
+    long long startHour;
+
+public:
+    explicit HourParser(std::string_view start_date) : startHour(epochDay(start_date) * 24) {}
+
+    /**
+     * @brief Hour offset of "YYYY-MM-DD HH" from start_date, false on malformed input
+     */
+    bool tryParse(std::string_view datetime, int& timestamp_hour) const {
+        CivilHour civil;
+        if (!parseCivilHour(datetime, civil)) return false;
+        timestamp_hour = (int)(daysFromCivil(civil.year, civil.month, civil.day) * 24 + civil.hour - startHour);
+        return true;
+    }
+
+    /**
+     * @throws std::invalid_argument on malformed input
+     */
+    int operator()(std::string_view datetime) const {
+        int timestamp_hour;
+        if (!tryParse(datetime, timestamp_hour)) {
+            throw std::invalid_argument("Expected YYYY-MM-DD HH: " + std::string(datetime));
+        }
+        return timestamp_hour;
+    }
+};
+
+/**
+ * ================================================================================
+ * PART 1 AND 2 ON THE EXACT CALENDAR
+ * ================================================================================
+ */
+
+/**
+ * @brief createSchedule over calculateDaysCivil, so ranges may cross months
+ */
+std::vector<TimeInterval> createScheduleCivil(const ScheduleSettings& settings) {
+    std::vector<TimeInterval> onIntervals;
+    int totalHours = calculateDaysCivil(settings.start_date, settings.end_date) * 24;
+    for (int currentHour = 0; currentHour < totalHours; currentHour += 2 * settings.interval_window_size_hours) {
+        onIntervals.push_back(TimeInterval(currentHour, std::min(currentHour + settings.interval_window_size_hours, totalHours)));
+    }
+    return onIntervals;
+}
+
+/**
+ * @brief Membership check straight from a log timestamp; malformed lines are OFF
+ *
+ * Time Complexity: O(log N)
+ * Space Complexity: O(1), no allocation
+ */
+bool isTimestampIncluded_Binary(const std::vector<TimeInterval>& scheduleIntervals,
+                                std::string_view datetime,
+                                const HourParser& parser) {
+    int timestamp_hour;
+    return parser.tryParse(datetime, timestamp_hour) && isTimestampIncluded_Binary(scheduleIntervals, timestamp_hour);
+}
+
+/**
+ * ================================================================================
+ * MAIN FUNCTION - TESTS AND BENCHMARK
+ * ================================================================================
+ */
+double elapsedMs(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+// Reference: day-by-day walk from 1970-01-01 (or backwards)
+long long slowEpochDay(int year, int month, int day) {
+    long long days = 0;
+    int y = 1970, m = 1, d = 1;
+    while (y != year || m != month || d != day) {
+        bool forward = std::make_tuple(y, m, d) < std::make_tuple(year, month, day);
+        if (forward) {
+            days++;
+            if (++d > daysInMonth(y, m)) { d = 1; if (++m > 12) { m = 1; y++; } }
+        } else {
+            days--;
+            if (--d < 1) { if (--m < 1) { m = 12; y--; } d = daysInMonth(y, m); }
+        }
+    }
+    return days;
+}
+
+std::string formatHour(int year, int month, int day, int hour) {
+    char buffer[16];
+    std::snprintf(buffer, sizeof(buffer), "%04d-%02d-%02d %02d", year, month, day, hour);
+    return buffer;
+}
+
+int main() {
+    std::cout << "================================================================================\n";
+    std::cout << "              SCHEDULE CREATOR - ALLOCATION-FREE DATETIME PARSING\n";
+    std::cout << "================================================================================\n\n";
+
+    // Calendar against a day-by-day walk, 1900..2100
+    long long expectedDay = slowEpochDay(1900, 1, 1);
+    for (int year = 1900; year <= 2100; year++) {
+        for (int month = 1; month <= 12; month++) {
+            for (int day = 1; day <= daysInMonth(year, month); day++) {
+                assert(daysFromCivil(year, month, day) == expectedDay);
+                expectedDay++;
+            }
+        }
+    }
+    assert(slowEpochDay(2023, 10, 1) == daysFromCivil(2023, 10, 1));
+    std::cout << "daysFromCivil matches a day-by-day walk for 1900-2100\n";
+
+    // Parser: same hours as dateTimeToHour inside one month, exact across months
+    HourParser parser("2023-10-01");
+    std::vector<std::string> samples = {"2023-10-01 05:00:00", "2023-10-01 12:00:00", "2023-10-02 15:00:00",
+                                        "2023-10-31 23", "2023-09-30 12:00:00", "2023-11-01 00", "2024-02-29 07",
+                                        "2024-03-01 07"};
+    std::cout << "\nTimestamp            | dateTimeToHour | Parsed (exact)\n";
+    std::cout << std::string(55, '-') << "\n";
+    for (const std::string& sample : samples) {
+        std::string padded = sample + std::string(21 - sample.size(), ' ');
+        std::cout << padded << "| " << dateTimeToHour(sample, "2023-10-01") << "\t\t | " << parser(sample) << "\n";
+    }
+    for (int day = 1; day <= 31; day++) {
+        for (int hour = 0; hour < 24; hour++) {
+            std::string stamp = formatHour(2023, 10, day, hour);
+            assert(parser(stamp) == dateTimeToHour(stamp, "2023-10-01"));
+        }
+    }
+    std::mt19937 rng(7);
+    for (int i = 0; i < 200000; i++) {
+        int year = 1 + rng() % 9999, month = 1 + rng() % 12;
+        int day = 1 + rng() % daysInMonth(year, month), hour = rng() % 24;
+        HourParser origin("1970-01-01");
+        assert(origin(formatHour(year, month, day, hour)) == daysFromCivil(year, month, day) * 24 + hour);
+    }
+    for (const char* bad : {"2023-13-01 00", "2023-02-29 00", "2024-02-30 00", "2023-10-01 24", "2023-10-00 05",
+                            "2023/10/01 05", "2023-10-01T05", "2023-1a-01 05", "2023-10-01 5", "20231001 05",
+                            "2023-10-01 0:", "2023-10-01"}) {
+        int hour;
+        assert(!parser.tryParse(bad, hour));
+    }
+    assert(calculateDaysCivil("2023-10-01", "2023-10-03") == calculateDays("2023-10-01", "2023-10-03"));
+    assert(calculateDaysCivil("2023-12-30", "2024-01-02") == 4);
+    assert(calculateDaysCivil("2024-02-01", "2024-03-01") == 30);
+    std::cout << "\nParser agrees with dateTimeToHour within a month, with daysFromCivil everywhere,\n"
+              << "and rejects malformed fields and impossible dates\n";
+
+    ScheduleSettings settings = {"2023-10-01", "2023-10-03", 9};
+    std::vector<TimeInterval> schedule = createScheduleCivil(settings);
+    HourParser scheduleParser(settings.start_date);
+    assert(isTimestampIncluded_Binary(schedule, "2023-10-01 05:00:00", scheduleParser));
+    assert(!isTimestampIncluded_Binary(schedule, "2023-10-01 12:00:00", scheduleParser));
+    assert(isTimestampIncluded_Binary(schedule, "2023-10-03 08:00:00", scheduleParser));
+    assert(!isTimestampIncluded_Binary(schedule, "2023-09-30 12:00:00", scheduleParser));
+    assert(!isTimestampIncluded_Binary(schedule, "garbage line", scheduleParser));
+
+    // Benchmark: parse + check on 100M log lines over a year-long, month-crossing schedule
+    std::cout << "\n" << std::string(70, '=') << "\n";
+    std::cout << "PERFORMANCE\n";
+    std::cout << std::string(70, '=') << "\n";
+    ScheduleSettings yearSettings = {"2023-01-01", "2023-12-31", 5};
+    std::vector<TimeInterval> yearSchedule = createScheduleCivil(yearSettings);
+    HourParser yearParser(yearSettings.start_date);
+
+    // 1M distinct fixed-width lines "YYYY-MM-DD HH:MM:SS\n", replayed 100 times
+    const size_t lineWidth = 20, distinct = 1000000, passes = 100;
+    std::string log;
+    log.reserve(distinct * lineWidth);
+    for (size_t i = 0; i < distinct; i++) {
+        int month = 1 + rng() % 12, day = 1 + rng() % daysInMonth(2023, month);
+        log += formatHour(2023, month, day, rng() % 24) + ":00:00\n";
+    }
+
+    size_t baselineLines = distinct * 10;
+    auto start = std::chrono::steady_clock::now();
+    long long baselineOn = 0;
+    for (size_t i = 0; i < baselineLines; i++) {
+        std::string line = log.substr((i % distinct) * lineWidth, lineWidth - 1);
+        baselineOn += isTimestampIncluded_Binary(yearSchedule, dateTimeToHour(line, yearSettings.start_date));
+    }
+    double baselineMs = elapsedMs(start);
+
+    size_t fastLines = distinct * passes;
+    start = std::chrono::steady_clock::now();
+    long long fastOn = 0;
+    for (size_t pass = 0; pass < passes; pass++) {
+        for (size_t offset = 0; offset < log.size(); offset += lineWidth) {
+            std::string_view line(log.data() + offset, lineWidth - 1);
+            fastOn += isTimestampIncluded_Binary(yearSchedule, line, yearParser);
+        }
+    }
+    double fastMs = elapsedMs(start);
+
+    start = std::chrono::steady_clock::now();
+    long long parsedSum = 0;
+    for (size_t pass = 0; pass < passes; pass++) {
+        for (size_t offset = 0; offset < log.size(); offset += lineWidth) {
+            parsedSum += yearParser(std::string_view(log.data() + offset, lineWidth - 1));
+        }
+    }
+    double parseOnlyMs = elapsedMs(start);
+
+    std::cout << "Schedule: " << yearSchedule.size() << " ON intervals over 2023\n";
+    std::cout << "• substr + stoi + binary search:  " << baselineLines / baselineMs / 1000 << " M lines/s ("
+              << baselineLines / 1000000 << "M lines, ON " << baselineOn << ", 30-day months)\n";
+    std::cout << "• SWAR parse + binary search:     " << fastLines / fastMs / 1000 << " M lines/s ("
+              << fastLines / 1000000 << "M lines, ON " << fastOn << ")\n";
+    std::cout << "• SWAR parse only:                " << fastLines / parseOnlyMs / 1000 << " M lines/s (checksum "
+              << parsedSum << ")\n";
+    std::cout << std::string(70, '=') << "\n";
+    return 0;
+}
+
+/*
+================================================================================
+                               PROBLEM STATEMENT
+================================================================================
+
+Part 2 of ScheduleCreation.cpp converts every timestamp with dateTimeToHour: seven
+substr + stoi calls, each building a temporary string, and a 30-day-month /
+365-day-year approximation. calculateDays only reads the day-of-month field, so a
+schedule cannot cross a month boundary.
+
+APPROACH:
+1. daysFromCivil: exact proleptic-Gregorian day number. Shift the year to begin
+   in March, count 400-year eras of 146097 days, then the day of the era.
+2. SWAR parsing from string_view, no allocation:
+   - "YYYY-MM-" is one 64-bit load; "MM-DD HH" is a second load at offset 5,
+     realigned with shifts so every field is a digit pair at an even offset.
+   - Digits and separators are validated with whole-word masks.
+   - (d * 10 + (d >> 8)) & 0x00FF00FF... turns all pairs into values at once.
+   - Month, day (leap-year aware) and hour are range-checked.
+3. HourParser converts start_date once; each line costs one parse, one
+   daysFromCivil and a subtraction. It feeds isTimestampIncluded_Binary directly,
+   and malformed lines count as OFF.
+4. calculateDaysCivil / createScheduleCivil: schedules across months and years.
+
+COMPLEXITY:
+Parse:  O(1) time, O(1) space, zero allocations
+Check:  O(log N) per line over N ON intervals
+
+================================================================================
+*/
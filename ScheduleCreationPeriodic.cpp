@@ -0,0 +1,412 @@
+/**
+ * ================================================================================
+ * Schedule Creator - Closed-Form Membership and Batch Classification
+ * ================================================================================
+ *
+ * Answers "is the entity ON at hour t" with arithmetic on the schedule rules instead
+ * of a materialized interval list, for single timestamps and for large batches.
+ * ================================================================================
+ */
+
+#include <iostream>
+#include <vector>
+#include <string>
+#include <random>
+#include <chrono>
+#include <algorithm>
+#include <stdexcept>
+#include <cassert>
+#include <cstdint>
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+/**
+ * ================================================================================
+ * BASELINE (same as ScheduleCreation.cpp)
+ * ================================================================================
+ */
+
+struct ScheduleSettings {
+    std::string start_date;              // "YYYY-MM-DD" format
+    std::string end_date;                // "YYYY-MM-DD" format
+    int interval_window_size_hours;      // Hours per ON/OFF cycle
+};
+
+struct TimeInterval {
+    int start_hour;  // Hours from start_date
+    int end_hour;    // Hours from start_date
+
+    TimeInterval(int start, int end) : start_hour(start), end_hour(end) {}
+};
+
+int calculateDays(const std::string& start_date, const std::string& end_date) {
+    int start_day = std::stoi(start_date.substr(8, 2));
+    int end_day = std::stoi(end_date.substr(8, 2));
+    return end_day - start_day + 1;
+}
+
+std::vector<TimeInterval> createSchedule(const ScheduleSettings& settings) {
+    std::vector<TimeInterval> onIntervals;
+    int totalHours = calculateDays(settings.start_date, settings.end_date) * 24;
+    int currentHour = 0;
+    bool isOn = true;
+    while (currentHour < totalHours) {
+        int intervalEnd = currentHour + settings.interval_window_size_hours;
+        if (isOn) {
+            onIntervals.push_back(TimeInterval(currentHour, std::min(intervalEnd, totalHours)));
+        }
+        currentHour = intervalEnd;
+        isOn = !isOn;
+    }
+    return onIntervals;
+}
+
+bool isTimestampIncluded_Binary(const std::vector<TimeInterval>& scheduleIntervals, int timestamp_hour) {
+    int left = 0;
+    int right = scheduleIntervals.size() - 1;
+    while (left <= right) {
+        int mid = left + (right - left) / 2;
+        const auto& interval = scheduleIntervals[mid];
+        if (timestamp_hour >= interval.start_hour && timestamp_hour < interval.end_hour) {
+            return true;
+        } else if (timestamp_hour < interval.start_hour) {
+            right = mid - 1;
+        } else {
+            left = mid + 1;
+        }
+    }
+    return false;
+}
+
+/**
+ * ================================================================================
+ * CLOSED-FORM SCHEDULE
+ * ================================================================================
+ */
+
+/**
+ * @brief One periodic rule, in hours from start_date
+ *
+ * ON at hour t when from <= t < until and (t - anchor) mod period < on_hours.
+ * createSchedule's alternation is {anchor 0, period 2w, on_hours w, [0, totalHours)}.
+ */
+struct PeriodicRule {
+    int anchor;
+    int period;
+    int on_hours;
+    int from;
+    int until;
+};
+
+/**
+ * @brief Hours [start_hour, end_hour) forced ON or OFF, overriding every rule
+ */
+struct ScheduleException {
+    int start_hour;
+    int end_hour;
+    bool on;
+};
+
+/**
+ * @brief Schedule as a union of periodic rules plus exceptions
+ *
+ * Nothing proportional to the horizon is stored: a rule is five integers, and
+ * membership is a range check and a modulo per rule. Exceptions are kept sorted and
+ * non-overlapping (a later exception wins where it overlaps an earlier one).
+ *
+ * The batch path works in single-precision floats, 4 timestamps per SSE2 register, so
+ * rules must span less than 2^24 hours (about 1900 years) from their anchor; there
+ * every intermediate value is an exact float.
+ */
+class PeriodicSchedule {
+private:
+    std::vector<PeriodicRule> rules;
+    std::vector<ScheduleException> exceptions;  // Sorted by start_hour, disjoint
+
+    static constexpr int FLOAT_EXACT_LIMIT = 1 << 24;
+
+    bool ruleIncludes(const PeriodicRule& rule, int timestamp_hour) const {
+        if (timestamp_hour < rule.from || timestamp_hour >= rule.until) {
+            return false;
+        }
+        int phase = (timestamp_hour - rule.anchor) % rule.period;
+        if (phase < 0) phase += rule.period;
+        return phase < rule.on_hours;
+    }
+
+    /**
+     * @brief Index of the exception containing the hour, or -1
+     *
+     * Time Complexity: O(log E) for E exceptions
+     */
+    int findException(int timestamp_hour) const {
+        auto it = std::upper_bound(exceptions.begin(), exceptions.end(), timestamp_hour,
+                                   [](int hour, const ScheduleException& e) { return hour < e.start_hour; });
+        if (it == exceptions.begin()) return -1;
+        --it;
+        return timestamp_hour < it->end_hour ? (int)(it - exceptions.begin()) : -1;
+    }
+
+public:
+    /**
+     * @brief The schedule createSchedule would materialize for these settings
+     */
+    static PeriodicSchedule fromSettings(const ScheduleSettings& settings) {
+        PeriodicSchedule schedule;
+        int window = settings.interval_window_size_hours;
+        int totalHours = calculateDays(settings.start_date, settings.end_date) * 24;
+        schedule.addRule({0, 2 * window, window, 0, totalHours});
+        return schedule;
+    }
+
+    void addRule(const PeriodicRule& rule) {
+        if (rule.period <= 0 || rule.on_hours < 0 || rule.from > rule.until) {
+            throw std::invalid_argument("Rule needs a positive period and from <= until");
+        }
+        if ((long long)rule.until - rule.anchor >= FLOAT_EXACT_LIMIT || (long long)rule.anchor - rule.from >= FLOAT_EXACT_LIMIT) {
+            throw std::invalid_argument("Rule must stay within 2^24 hours of its anchor");
+        }
+        rules.push_back(rule);
+    }
+
+    /**
+     * @brief Forces [start_hour, end_hour) ON or OFF; overlapped parts of earlier
+     * exceptions are trimmed away
+     */
+    void addException(int start_hour, int end_hour, bool on) {
+        if (start_hour >= end_hour) return;
+        std::vector<ScheduleException> merged;
+        for (const ScheduleException& e : exceptions) {
+            if (e.end_hour <= start_hour || e.start_hour >= end_hour) {
+                merged.push_back(e);
+                continue;
+            }
+            if (e.start_hour < start_hour) merged.push_back({e.start_hour, start_hour, e.on});
+            if (e.end_hour > end_hour) merged.push_back({end_hour, e.end_hour, e.on});
+        }
+        merged.push_back({start_hour, end_hour, on});
+        std::sort(merged.begin(), merged.end(),
+                  [](const ScheduleException& a, const ScheduleException& b) { return a.start_hour < b.start_hour; });
+        exceptions.swap(merged);
+    }
+
+    /**
+     * @brief Closed-form membership
+     *
+     * Time Complexity: O(R + log E) for R rules and E exceptions; O(1) for a plain
+     * createSchedule-style schedule (one rule, no exceptions)
+     * Space Complexity: O(1)
+     */
+    bool isTimestampIncluded(int timestamp_hour) const {
+        if (!exceptions.empty()) {
+            int e = findException(timestamp_hour);
+            if (e >= 0) return exceptions[e].on;
+        }
+        for (const PeriodicRule& rule : rules) {
+            if (ruleIncludes(rule, timestamp_hour)) return true;
+        }
+        return false;
+    }
+
+    /**
+     * @brief Classifies count hours, out[i] = 1 when hours[i] is ON
+     *
+     * Per rule, 4 lanes at a time: integer range check, then the phase in floats,
+     *   q = trunc(rel / period), phase = rel - q * period, corrected into [0, period)
+     * (the reciprocal can leave q off by one). Rules are ORed; timestamps that fall
+     * inside the span of the exceptions are then resolved with the scalar lookup.
+     */
+    void classify(const int* hours, size_t count, uint8_t* out) const {
+        size_t i = 0;
+#if defined(__SSE2__)
+        const __m128 zero = _mm_setzero_ps();
+        for (; i + 16 <= count; i += 16) {
+            __m128i lanes[4];
+            for (int v = 0; v < 4; v++) {
+                __m128i t = _mm_loadu_si128((const __m128i*)(hours + i + 4 * v));
+                __m128i on = _mm_setzero_si128();
+                for (const PeriodicRule& rule : rules) {
+                    __m128i inRange = _mm_andnot_si128(_mm_cmplt_epi32(t, _mm_set1_epi32(rule.from)),
+                                                       _mm_cmplt_epi32(t, _mm_set1_epi32(rule.until)));
+                    __m128 period = _mm_set1_ps((float)rule.period);
+                    __m128 rel = _mm_cvtepi32_ps(_mm_sub_epi32(t, _mm_set1_epi32(rule.anchor)));
+                    __m128 q = _mm_cvtepi32_ps(_mm_cvttps_epi32(_mm_mul_ps(rel, _mm_set1_ps(1.0f / rule.period))));
+                    __m128 phase = _mm_sub_ps(rel, _mm_mul_ps(q, period));
+                    phase = _mm_add_ps(phase, _mm_and_ps(_mm_cmplt_ps(phase, zero), period));
+                    phase = _mm_sub_ps(phase, _mm_and_ps(_mm_cmpge_ps(phase, period), period));
+                    __m128i onPhase = _mm_castps_si128(_mm_cmplt_ps(phase, _mm_set1_ps((float)rule.on_hours)));
+                    on = _mm_or_si128(on, _mm_and_si128(inRange, onPhase));
+                }
+                lanes[v] = on;
+            }
+            // 16 lanes of 0 / -1 packed to 16 bytes of 0 / 1
+            __m128i bytes = _mm_packs_epi16(_mm_packs_epi32(lanes[0], lanes[1]), _mm_packs_epi32(lanes[2], lanes[3]));
+            _mm_storeu_si128((__m128i*)(out + i), _mm_and_si128(bytes, _mm_set1_epi8(1)));
+        }
+#endif
+        for (; i < count; i++) {
+            bool on = false;
+            for (const PeriodicRule& rule : rules) on = on || ruleIncludes(rule, hours[i]);
+            out[i] = on;
+        }
+        if (!exceptions.empty()) {
+            int first = exceptions.front().start_hour, last = exceptions.back().end_hour;
+            for (size_t k = 0; k < count; k++) {
+                if (hours[k] < first || hours[k] >= last) continue;
+                int e = findException(hours[k]);
+                if (e >= 0) out[k] = exceptions[e].on;
+            }
+        }
+    }
+
+    size_t ruleCount() const {
+        return rules.size();
+    }
+};
+
+/**
+ * ================================================================================
+ * MAIN FUNCTION - TESTS AND BENCHMARK
+ * ================================================================================
+ */
+double elapsedMs(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+int main() {
+    std::cout << "================================================================================\n";
+    std::cout << "           SCHEDULE CREATOR - CLOSED-FORM MEMBERSHIP AND BATCH CHECKS\n";
+    std::cout << "================================================================================\n\n";
+
+    // Same results as the interval list for the settings of ScheduleCreation.cpp
+    ScheduleSettings settings = {"2023-10-01", "2023-10-03", 9};
+    PeriodicSchedule schedule = PeriodicSchedule::fromSettings(settings);
+    std::vector<TimeInterval> intervals = createSchedule(settings);
+    std::cout << "Settings: start=" << settings.start_date << ", end=" << settings.end_date
+              << ", interval=" << settings.interval_window_size_hours << " hours\n";
+    for (int hour : {5, 12, 20, 25, 39, 46, 56, 68, -12, 100}) {
+        bool closedForm = schedule.isTimestampIncluded(hour);
+        std::cout << "Hour " << hour << ": " << (closedForm ? "ON " : "OFF")
+                  << (closedForm == isTimestampIncluded_Binary(intervals, hour) ? "  ✓" : "  ✗") << "\n";
+    }
+
+    for (int window = 1; window <= 30; window++) {
+        for (const char* end : {"2023-10-01", "2023-10-02", "2023-10-07", "2023-10-31"}) {
+            ScheduleSettings s = {"2023-10-01", end, window};
+            PeriodicSchedule closedForm = PeriodicSchedule::fromSettings(s);
+            std::vector<TimeInterval> list = createSchedule(s);
+            std::vector<int> hours;
+            for (int hour = -50; hour < 800; hour++) hours.push_back(hour);
+            std::vector<uint8_t> batch(hours.size());
+            closedForm.classify(hours.data(), hours.size(), batch.data());
+            for (size_t k = 0; k < hours.size(); k++) {
+                bool expected = isTimestampIncluded_Binary(list, hours[k]);
+                assert(closedForm.isTimestampIncluded(hours[k]) == expected);
+                assert(batch[k] == expected);
+            }
+        }
+    }
+    std::cout << "\nClosed form and batch match createSchedule + binary search\n";
+
+    // Irregular schedule: weekday business hours, plus a 2-on / 5-off maintenance rule,
+    // a forced-off holiday and a forced-on weekend shift. Checked against an hour table.
+    PeriodicSchedule irregular;
+    int horizon = 24 * 365;
+    for (int day = 0; day < 5; day++) irregular.addRule({24 * day + 9, 24 * 7, 8, 0, horizon});
+    irregular.addRule({3, 7, 2, 1000, 5000});
+    irregular.addException(24 * 30, 24 * 31, false);
+    irregular.addException(24 * 40 + 6, 24 * 41, true);
+    irregular.addException(24 * 40 + 20, 24 * 42, false);
+    std::vector<uint8_t> table(horizon + 200, 0);
+    for (int t = 0; t < horizon; t++) {
+        bool on = (t % (24 * 7)) / 24 < 5 && t % 24 >= 9 && t % 24 < 17;
+        on = on || (t >= 1000 && t < 5000 && (t - 3) % 7 < 2);
+        if (t >= 24 * 30 && t < 24 * 31) on = false;
+        if (t >= 24 * 40 + 6 && t < 24 * 40 + 20) on = true;
+        if (t >= 24 * 40 + 20 && t < 24 * 42) on = false;
+        table[t] = on;
+    }
+    std::vector<int> hours;
+    for (int t = -100; t < horizon + 100; t++) hours.push_back(t);
+    std::vector<uint8_t> batch(hours.size());
+    irregular.classify(hours.data(), hours.size(), batch.data());
+    for (size_t k = 0; k < hours.size(); k++) {
+        bool expected = hours[k] >= 0 && hours[k] < horizon && table[hours[k]];
+        assert(irregular.isTimestampIncluded(hours[k]) == expected);
+        assert(batch[k] == expected);
+    }
+    std::cout << "Irregular schedule (" << irregular.ruleCount() << " rules, 3 exceptions) matches the hour table\n";
+
+    // Benchmark: a 10-year schedule with a 5-hour window, 50M random hours
+    std::cout << "\n" << std::string(70, '=') << "\n";
+    std::cout << "PERFORMANCE\n";
+    std::cout << std::string(70, '=') << "\n";
+    int years = 10, window = 5, totalHours = 24 * 365 * years;
+    std::vector<TimeInterval> longList;
+    for (int h = 0; h < totalHours; h += 2 * window) longList.push_back(TimeInterval(h, std::min(h + window, totalHours)));
+    PeriodicSchedule longSchedule;
+    longSchedule.addRule({0, 2 * window, window, 0, totalHours});
+
+    size_t count = 50000000;
+    std::mt19937 rng(1);
+    std::vector<int> queries(count);
+    for (int& q : queries) q = (int)(rng() % (totalHours + 1000)) - 500;
+    std::vector<uint8_t> results(count);
+
+    auto start = std::chrono::steady_clock::now();
+    long long binaryOn = 0;
+    for (int q : queries) binaryOn += isTimestampIncluded_Binary(longList, q);
+    double binaryMs = elapsedMs(start);
+
+    start = std::chrono::steady_clock::now();
+    long long scalarOn = 0;
+    for (int q : queries) scalarOn += longSchedule.isTimestampIncluded(q);
+    double scalarMs = elapsedMs(start);
+
+    start = std::chrono::steady_clock::now();
+    longSchedule.classify(queries.data(), count, results.data());
+    double batchMs = elapsedMs(start);
+    long long batchOn = 0;
+    for (uint8_t r : results) batchOn += r;
+
+    std::cout << count / 1000000 << "M timestamps over " << longList.size() << " ON intervals:\n";
+    std::cout << "• Binary search:      " << count / binaryMs / 1000 << " M/s (ON " << binaryOn << ")\n";
+    std::cout << "• Closed form:        " << count / scalarMs / 1000 << " M/s (ON " << scalarOn << ")\n";
+    std::cout << "• Batch classify:     " << count / batchMs / 1000 << " M/s (ON " << batchOn << ")\n";
+    std::cout << "• Interval list size: " << longList.size() * sizeof(TimeInterval) / 1024 << " KB, rule size: "
+              << sizeof(PeriodicRule) << " bytes\n";
+    std::cout << std::string(70, '=') << "\n";
+    return 0;
+}
+
+/*
+================================================================================
+                               PROBLEM STATEMENT
+================================================================================
+
+Same schedule as ScheduleCreation.cpp. createSchedule materializes every ON
+interval and isTimestampIncluded_Binary searches them, O(log N) per timestamp and
+O(N) memory, although a fixed-period schedule is pure arithmetic.
+
+APPROACH:
+1. PeriodicRule {anchor, period, on_hours, from, until}:
+     ON  <=>  from <= t < until  and  (t - anchor) mod period < on_hours
+   createSchedule's alternation is one rule with period 2w and on_hours w.
+2. Irregular schedules: a union of rules (e.g. one rule per weekday) plus sorted,
+   disjoint exceptions that force hours ON or OFF and override the rules.
+3. isTimestampIncluded: exception lookup (binary search, only if there are any),
+   then one range check and modulo per rule.
+4. classify (batch): SSE2, 4 timestamps per register, 16 per iteration. The range
+   check is integer compares; the phase is computed in floats with a reciprocal
+   multiply, truncation and a +-period correction, exact while |t - anchor| < 2^24.
+   The lane masks are packed to bytes with two saturating packs. Only timestamps
+   inside the exceptions' span go through the scalar exception lookup.
+
+COMPLEXITY:
+isTimestampIncluded: O(R + log E) time, O(1) for the createSchedule case
+classify:            O(count * R / 4) vector operations
+Memory:              O(R + E), independent of the horizon
+
+================================================================================
+*/
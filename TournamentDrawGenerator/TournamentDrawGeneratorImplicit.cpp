@@ -0,0 +1,277 @@
+/**
+ * Tennis Tournament Simulator - Implicit Seeded Bracket
+ *
+ * Computes any position of the Part 2 seeded draw directly from its index, without
+ * building the bracket, and fills the full draw in place when it is needed.
+ */
+
+#include <iostream>
+#include <vector>
+#include <algorithm>
+#include <random>
+#include <chrono>
+#include <cassert>
+#include <cstdint>
+#include <stdexcept>
+using namespace std;
+
+/**
+ * Same as TournamentDrawGenerator.cpp, kept here as the benchmark baseline
+ */
+vector<int> expandDraw(const vector<int>& baseDraw) {
+    vector<int> expandedDraw(baseDraw.size() * 2);
+    for (size_t i = 0; i < baseDraw.size(); i++) {
+        expandedDraw[i * 2] = baseDraw[i];
+        expandedDraw[i * 2 + 1] = baseDraw[i] + (int)baseDraw.size();
+    }
+    return expandedDraw;
+}
+
+vector<int> generateDraw(int n) {
+    vector<int> base = {1};
+    while ((int)base.size() < n) {
+        base = expandDraw(base);
+    }
+    for (int i = 0; i < (int)base.size(); i++) {
+        if (base[i] > n) {
+            base[i] = -1;
+        }
+    }
+    return base;
+}
+
+/**
+ * Number of rounds for n players: the bracket has 2^bits slots
+ *
+ * Example: n=6 → 3 (8 slots), n=8 → 3, n=9 → 4
+ *
+ * Time Complexity: O(1)
+ */
+int bracketBits(int n) {
+    int bits = 0;
+    while ((1 << bits) < n) bits++;
+    return bits;
+}
+
+/**
+ * Reverses the low `bits` bits of x
+ *
+ * Swaps halves, then quarters, ... of the 32-bit word (5 mask-and-shift steps),
+ * then drops the bits that came from above `bits`.
+ *
+ * Time Complexity: O(1)
+ */
+uint32_t reverseBits(uint32_t x, int bits) {
+    if (bits == 0) return 0;
+    x = (x >> 16) | (x << 16);
+    x = ((x >> 8) & 0x00FF00FFu) | ((x & 0x00FF00FFu) << 8);
+    x = ((x >> 4) & 0x0F0F0F0Fu) | ((x & 0x0F0F0F0Fu) << 4);
+    x = ((x >> 2) & 0x33333333u) | ((x & 0x33333333u) << 2);
+    x = ((x >> 1) & 0x55555555u) | ((x & 0x55555555u) << 1);
+    return x >> (32 - bits);
+}
+
+/**
+ * Seed placed at a bracket slot, closed form
+ *
+ * expandDraw puts base[i] at slot 2i and base[i] + size at slot 2i+1, so the last
+ * bit of the slot decides the largest seed offset, the next bit the next offset,
+ * and so on:
+ *   seed(slot) - 1 = slot with its `bits` bits reversed
+ *
+ * Example (8 slots): slot 3 = 011 → 110 = 6 → seed 7
+ *                    slot 4 = 100 → 001 = 1 → seed 2
+ *
+ * Time Complexity: O(1)
+ *
+ * @param slot Position in the first round, 0..2^bits-1
+ * @param n Number of actual players
+ * @return Seed at that slot, or -1 for a BYE
+ */
+int seedAtSlot(int slot, int n) {
+    int seed = (int)reverseBits(slot, bracketBits(n)) + 1;
+    return seed > n ? -1 : seed;
+}
+
+/**
+ * Bracket slot of a seed: bit reversal is its own inverse
+ *
+ * Time Complexity: O(1)
+ *
+ * @param seed 1..n
+ * @param n Number of actual players
+ */
+int slotOfSeed(int seed, int n) {
+    return (int)reverseBits(seed - 1, bracketBits(n));
+}
+
+/**
+ * Round in which two seeds would meet if both keep winning (1 = first round)
+ *
+ * Two slots share a round-r match exactly when they agree on all bits above r-1,
+ * so the round is one more than the highest differing bit.
+ *
+ * Time Complexity: O(1)
+ *
+ * @throws invalid_argument if a seed is outside 1..n or both seeds are the same
+ *         (identical slots have no differing bit)
+ */
+int meetingRound(int seedA, int seedB, int n) {
+    if (seedA < 1 || seedA > n || seedB < 1 || seedB > n) {
+        throw invalid_argument("Seeds must be in 1.." + to_string(n));
+    }
+    if (seedA == seedB) {
+        throw invalid_argument("A seed does not meet itself");
+    }
+    uint32_t differ = slotOfSeed(seedA, n) ^ slotOfSeed(seedB, n);
+    return 32 - __builtin_clz(differ);
+}
+
+/**
+ * Fills the whole seeded draw into out[0..2^bracketBits(n)), in place
+ *
+ * Runs the expandDraw doubling inside the output array itself: each doubling
+ * walks the current prefix backwards, so base[i] is read before slot i is
+ * overwritten, and no intermediate vectors are allocated. Doublings cost 1 + 2 +
+ * ... + 2^bits / 2 < 2^bits moves in total, followed by one BYE pass.
+ *
+ * Time Complexity: O(n)
+ * Space Complexity: O(1) beyond the output
+ */
+void fillDraw(int* out, int n) {
+    int size = 1 << bracketBits(n);
+    out[0] = 1;
+    for (int half = 1; half < size; half *= 2) {
+        for (int i = half - 1; i >= 0; i--) {
+            int seed = out[i];
+            out[2 * i] = seed;
+            out[2 * i + 1] = seed + half;
+        }
+    }
+    for (int i = 0; i < size; i++) {
+        if (out[i] > n) out[i] = -1;
+    }
+}
+
+double elapsedMs(chrono::steady_clock::time_point start) {
+    return chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+}
+
+int main() {
+    cout << "=== Implicit Seeded Draw (6 players) ===" << endl;
+    int n = 6;
+    for (int slot = 0; slot < (1 << bracketBits(n)); slot++) {
+        int seed = seedAtSlot(slot, n);
+        cout << (seed == -1 ? "BYE" : to_string(seed)) << " ";
+    }
+    cout << endl;
+    cout << "Seed 4 sits at slot " << slotOfSeed(4, n) << "; seeds 1 and 2 meet in round "
+         << meetingRound(1, 2, n) << ", seeds 1 and 3 in round " << meetingRound(1, 3, n) << endl;
+
+    // Every position against the materialized draw
+    for (int players = 1; players <= 1100; players++) {
+        vector<int> expected = generateDraw(players);
+        vector<int> filled(expected.size());
+        fillDraw(filled.data(), players);
+        assert(filled == expected);
+        for (int slot = 0; slot < (int)expected.size(); slot++) {
+            assert(seedAtSlot(slot, players) == expected[slot]);
+        }
+        for (int seed = 1; seed <= players; seed++) {
+            assert(expected[slotOfSeed(seed, players)] == seed);
+        }
+    }
+    // Seeds 1..2^k are all in different round-(bits-k+1) sections: top seeds meet last
+    for (int seedA = 1; seedA <= 64; seedA++) {
+        for (int seedB = seedA + 1; seedB <= 64; seedB++) {
+            int stronger = 32 - __builtin_clz(seedB - 1);  // seedB is among the top 2^stronger seeds
+            assert(meetingRound(seedA, seedB, 64) >= 6 - stronger + 1);
+        }
+    }
+    for (auto seeds : {make_pair(3, 3), make_pair(0, 2), make_pair(1, 65)}) {
+        try {
+            meetingRound(seeds.first, seeds.second, 64);
+            assert(false && "meetingRound accepted an invalid pair");
+        } catch (const invalid_argument&) {
+        }
+    }
+    cout << "Closed form and in-place fill match generateDraw for 1..1100 players" << endl;
+
+    // Benchmark at 2^26 players
+    n = 1 << 26;
+    cout << "\n=== Performance (n = 2^26) ===" << endl;
+    auto start = chrono::steady_clock::now();
+    vector<int> baseline = generateDraw(n);
+    double baselineMs = elapsedMs(start);
+
+    vector<int> filled(n);
+    start = chrono::steady_clock::now();
+    fillDraw(filled.data(), n);
+    double fillMs = elapsedMs(start);
+    assert(filled == baseline);
+
+    vector<int> closedForm(n);
+    start = chrono::steady_clock::now();
+    for (int slot = 0; slot < n; slot++) {
+        closedForm[slot] = seedAtSlot(slot, n);
+    }
+    double closedFormMs = elapsedMs(start);
+    assert(closedForm == baseline);
+
+    const int queries = 10000000;
+    mt19937 rng(5);
+    vector<int> slots(queries);
+    for (int& slot : slots) slot = rng() % n;
+    start = chrono::steady_clock::now();
+    long long checksum = 0;
+    for (int slot : slots) checksum += seedAtSlot(slot, n) ^ slotOfSeed(1 + slot, n);
+    double queryMs = elapsedMs(start);
+    vector<int> slotOf(n + 1);
+    for (int slot = 0; slot < n; slot++) slotOf[baseline[slot]] = slot;
+    long long expectedChecksum = 0;
+    for (int slot : slots) expectedChecksum += baseline[slot] ^ slotOf[1 + slot];
+    assert(checksum == expectedChecksum);
+
+    cout << "generateDraw (repeated expandDraw): " << baselineMs << " ms" << endl;
+    cout << "fillDraw (in-place doubling):       " << fillMs << " ms" << endl;
+    cout << "seedAtSlot for every slot:          " << closedFormMs << " ms" << endl;
+    cout << "Random slot→seed + seed→slot:       " << queryMs * 1e6 / queries << " ns/query pair, no draw in memory"
+         << endl;
+
+    return 0;
+}
+
+/*
+===============================================================================
+PROBLEM STATEMENT
+===============================================================================
+
+Part 2 of TournamentDrawGenerator.cpp builds the seeded draw by calling expandDraw
+until the bracket is big enough, allocating a fresh vector each doubling. Large
+brackets only need individual positions (which seed plays at slot s, where seed k
+starts, when two seeds can meet), and the full draw should not need a chain of
+temporary vectors.
+
+APPROACH:
+expandDraw maps base[i] to slots 2i and 2i+1, adding the current size at the odd
+slot. Unrolled over all doublings, the last slot bit chooses the biggest offset:
+
+    seed(slot) = reverse_bits(slot, rounds) + 1
+    slot(seed) = reverse_bits(seed - 1, rounds)
+
+Example, 8 slots: slots 000..111 → reversed 0,4,2,6,1,5,3,7 → seeds
+[1, 5, 3, 7, 2, 6, 4, 8], the same draw as generateDraw(8). Seeds above n are BYEs.
+
+meetingRound: slots play each other in round r iff they match above bit r-1, so
+the round is the index of the highest set bit of slotA XOR slotB, plus one.
+
+fillDraw: the same doubling, done backwards inside the output array, so the full
+draw is produced with one allocation owned by the caller.
+
+COMPLEXITY:
+seedAtSlot / slotOfSeed / meetingRound: O(1) time, O(1) space
+fillDraw: O(n) time, O(1) extra space
+generateDraw (baseline): O(n) moves but log n vector allocations and copies
+
+===============================================================================
+*/
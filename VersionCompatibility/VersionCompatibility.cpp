@@ -1,4 +1,5 @@
 #include<bits/stdc++.h>
+#include "../DSU.h"
 using namespace std;
 
 /**
@@ -12,71 +13,12 @@ using namespace std;
 
 /**
  * Disjoint Set Union (Union-Find) Data Structure
- * 
- * Time Complexity:
- * - find(): O(α(n)) amortized (inverse Ackermann function - practically constant)
- * - unionBySize(): O(α(n)) amortized
- * - connected(): O(α(n)) amortized
- * 
- * Space Complexity: O(number of elements)
- * 
- * Features:
- * - Path compression: flattens tree during find operations
- * - Union by size: attaches smaller tree under root of larger tree
+ *
+ * Shared HashedDSU from DSU.h: version numbers are interned to dense ids once, then
+ * find uses iterative path halving and union by size over flat arrays.
+ * Unknown versions are added as singleton sets on first use.
  */
-class DSU {
-private:
-    unordered_map<int, int> parent; // parent[x] = parent of element x
-    unordered_map<int, int> size;   // size[x] = size of tree rooted at x
-    
-public:
-    /**
-     * Finds the root of the set containing x with path compression
-     * @param x: element to find root for
-     * @return: root of the set containing x
-     */
-    int find(int x) {
-        if (parent.find(x) == parent.end()) {
-            parent[x] = x;
-            size[x] = 1;
-            return x;
-        }
-        if (parent[x] != x) {
-            parent[x] = find(parent[x]); // path compression
-        }
-        return parent[x];
-    }
-    
-    /**
-     * Unites the sets containing x and y using union by size
-     * @param x: first element
-     * @param y: second element
-     */
-    void unionBySize(int x, int y) {
-        int rootX = find(x);
-        int rootY = find(y);
-        
-        if (rootX != rootY) {
-            if (size[rootX] < size[rootY]) {
-                parent[rootX] = rootY;
-                size[rootY] += size[rootX];
-            } else {
-                parent[rootY] = rootX;
-                size[rootX] += size[rootY];
-            }
-        }
-    }
-    
-    /**
-     * Checks if x and y are in the same connected component
-     * @param x: first element
-     * @param y: second element
-     * @return: true if x and y are connected, false otherwise
-     */
-    bool connected(int x, int y) {
-        return find(x) == find(y);
-    }
-};
+using DSU = HashedDSU<int>;
 
 /**
  * HashMap-based Version Management
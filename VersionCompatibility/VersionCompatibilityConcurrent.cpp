@@ -0,0 +1,257 @@
+#include<bits/stdc++.h>
+using namespace std;
+
+/**
+ * Concurrent Version Management (single writer, many readers)
+ *
+ * Same problem as VersionCompatibility.cpp, for a release service where one thread
+ * appends versions through addNewVersion while thousands of request threads call
+ * isCompatible. None of the VersionManagement* classes there are thread-safe:
+ * vector::push_back may reallocate under a reader.
+ */
+
+/**
+ * Lock-free single-writer / multi-reader Version Management
+ *
+ * Time Complexity:
+ * - addNewVersion(): O(1), plus one chunk allocation every ChunkSize versions
+ * - isCompatible(): O(1), one acquire load and two array reads, never blocks
+ *
+ * Space Complexity: O(number of versions)
+ *
+ * Description: Same group ID idea as VersionManagementPrefixSum, but the group IDs live
+ * in fixed-size chunks that are never moved once allocated, so a reader can never
+ * see an element relocated under it. The chunk directory is sized up front.
+ * The writer fills in a slot and only then advances publishedVersions with a
+ * release store. A reader acquire-loads publishedVersions, so every slot at or below
+ * it is fully written and visible. Versions above it do not exist yet for that reader.
+ */
+class VersionManagementConcurrent {
+private:
+    static constexpr int ChunkBits = 16;
+    static constexpr int ChunkSize = 1 << ChunkBits;
+    static constexpr int MaxChunks = 1 << 14; // 2^30 versions
+
+    unique_ptr<atomic<int*>[]> chunks;  // chunk directory, allocated once
+    atomic<int> publishedVersions{0};   // versions 1..publishedVersions are readable
+
+    // Writer-only state
+    int currentVersion = 0;
+    int currentGroup = 0;
+
+    int groupOf(int ver) const {
+        int index = ver - 1;
+        return chunks[index >> ChunkBits].load(memory_order_relaxed)[index & (ChunkSize - 1)];
+    }
+
+public:
+    VersionManagementConcurrent() : chunks(new atomic<int*>[MaxChunks]) {
+        for (int i = 0; i < MaxChunks; i++) {
+            chunks[i].store(nullptr, memory_order_relaxed);
+        }
+    }
+
+    ~VersionManagementConcurrent() {
+        for (int i = 0; i < MaxChunks; i++) {
+            delete[] chunks[i].load(memory_order_relaxed);
+        }
+    }
+
+    VersionManagementConcurrent(const VersionManagementConcurrent&) = delete;
+    VersionManagementConcurrent& operator=(const VersionManagementConcurrent&) = delete;
+
+    /**
+     * Adds a new version with its compatibility status. Must only be called from
+     * one thread at a time.
+     * @param ver: version number (should be sequential: 1, 2, 3, ...)
+     * @param isCompatibleWithPrev: whether this version is compatible with previous one
+     */
+    void addNewVersion([[maybe_unused]] int ver, bool isCompatibleWithPrev) {
+        int index = currentVersion;
+        if (index == MaxChunks * ChunkSize) {
+            throw length_error("Version registry is full");
+        }
+        if (currentVersion == 0 || !isCompatibleWithPrev) {
+            currentGroup++;
+        }
+        int* chunk = chunks[index >> ChunkBits].load(memory_order_relaxed);
+        if (chunk == nullptr) {
+            chunk = new int[ChunkSize];
+            // Relaxed is enough: readers only dereference it after acquiring a
+            // publishedVersions value that was released after this store
+            chunks[index >> ChunkBits].store(chunk, memory_order_relaxed);
+        }
+        chunk[index & (ChunkSize - 1)] = currentGroup;
+        currentVersion++;
+        publishedVersions.store(currentVersion, memory_order_release);
+    }
+
+    /**
+     * Checks if upgrade from srcVer to targetVer is possible. Safe to call from any
+     * number of threads concurrently with addNewVersion.
+     * @param srcVer: source version
+     * @param targetVer: target version
+     * @return: true if compatible upgrade possible, false otherwise
+     */
+    bool isCompatible(int srcVer, int targetVer) const {
+        if (srcVer == targetVer) {
+            return true;
+        }
+        if (srcVer > targetVer) {
+            return false;
+        }
+        int published = publishedVersions.load(memory_order_acquire);
+        if (srcVer < 1 || targetVer > published) {
+            return false;
+        }
+        return groupOf(srcVer) == groupOf(targetVer);
+    }
+
+    /**
+     * Number of versions visible to readers right now
+     */
+    int latestVersion() const {
+        return publishedVersions.load(memory_order_acquire);
+    }
+};
+
+/**
+ * PrefixSum-based Version Management behind a shared_mutex, the straightforward
+ * thread-safe baseline for the benchmark.
+ */
+class VersionManagementSharedMutex {
+private:
+    mutable shared_mutex lock;
+    vector<int> groupID; // groupID[i] = compatibility group of version i+1
+    int currentGroup = 0;
+
+public:
+    void addNewVersion([[maybe_unused]] int ver, bool isCompatibleWithPrev) {
+        unique_lock<shared_mutex> guard(lock);
+        if (groupID.empty() || !isCompatibleWithPrev) {
+            currentGroup++;
+        }
+        groupID.push_back(currentGroup);
+    }
+
+    bool isCompatible(int srcVer, int targetVer) const {
+        if (srcVer == targetVer) {
+            return true;
+        }
+        if (srcVer > targetVer) {
+            return false;
+        }
+        shared_lock<shared_mutex> guard(lock);
+        if (srcVer < 1 || targetVer > (int)groupID.size()) {
+            return false;
+        }
+        return groupID[srcVer - 1] == groupID[targetVer - 1];
+    }
+
+    int latestVersion() const {
+        shared_lock<shared_mutex> guard(lock);
+        return groupID.size();
+    }
+};
+
+/**
+ * For `seconds`, one writer appends versions, breaking compatibility every `groupSize`
+ * versions, while `readers` threads run random isCompatible checks against the
+ * versions published so far. Version v is in group (v - 1) / groupSize, so every
+ * reader verifies each answer it gets: a torn or stale slot fails the run.
+ * The run is time-boxed because a reader-preferring lock can starve the writer.
+ */
+template <typename Registry>
+void contention(const string& label, int readers, int groupSize, double seconds) {
+    Registry registry;
+    atomic<bool> stop{false};
+    atomic<long long> totalQueries{0}, wrongAnswers{0};
+
+    vector<thread> threads;
+    for (int r = 0; r < readers; r++) {
+        threads.emplace_back([&, r]() {
+            mt19937 rng(100 + r);
+            long long queries = 0, wrong = 0;
+            while (!stop.load(memory_order_relaxed)) {
+                int latest = registry.latestVersion();
+                if (latest == 0) {
+                    this_thread::yield();
+                    continue;
+                }
+                for (int i = 0; i < 1024; i++) {
+                    int src = 1 + rng() % latest;
+                    int target = src + rng() % (2 * groupSize);
+                    bool expected = target <= latest && (src - 1) / groupSize == (target - 1) / groupSize;
+                    bool got = registry.isCompatible(src, target);
+                    // A target above our snapshot may have been published meanwhile
+                    if (got != expected && target <= latest) wrong++;
+                }
+                queries += 1024;
+            }
+            totalQueries += queries;
+            wrongAnswers += wrong;
+        });
+    }
+
+    auto start = chrono::steady_clock::now();
+    auto deadline = start + chrono::duration<double>(seconds);
+    int appended = 0;
+    while (chrono::steady_clock::now() < deadline) {
+        for (int i = 0; i < 256; i++) {
+            appended++;
+            registry.addNewVersion(appended, (appended - 1) % groupSize != 0);
+        }
+    }
+    stop = true;
+    for (thread& t : threads) t.join();
+    double ms = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+
+    cout << "  " << label << ": writer " << appended / ms / 1000.0 << " M appends/s, readers "
+         << totalQueries / ms / 1000.0 << " M queries/s, wrong answers: " << wrongAnswers << "\n";
+}
+
+int main() {
+    cout << "Testing Concurrent implementation (lock-free O(1) compatibility check):\n";
+    VersionManagementConcurrent concurrentVersion;
+    concurrentVersion.addNewVersion(1, false);
+    concurrentVersion.addNewVersion(2, true);
+    concurrentVersion.addNewVersion(3, true);
+    concurrentVersion.addNewVersion(4, false);
+    concurrentVersion.addNewVersion(5, true);
+    concurrentVersion.addNewVersion(6, true);
+
+    assert(concurrentVersion.isCompatible(1, 3) == true);
+    assert(concurrentVersion.isCompatible(3, 5) == false);
+    assert(concurrentVersion.isCompatible(4, 2) == false);
+    assert(concurrentVersion.isCompatible(3, 3) == true);
+    assert(concurrentVersion.isCompatible(4, 6) == true);
+    assert(concurrentVersion.isCompatible(4, 7) == false);
+    cout << "Concurrent tests passed!\n\n";
+
+    int hardware = max(2u, thread::hardware_concurrency());
+    for (int readers : {1, hardware, 4 * hardware}) {
+        cout << "1 writer, " << readers << " readers:\n";
+        contention<VersionManagementConcurrent>("Lock-free   ", readers, 1000, 2.0);
+        contention<VersionManagementSharedMutex>("shared_mutex", readers, 1000, 2.0);
+    }
+    return 0;
+}
+
+/*
+Problem Summary:
+Same as VersionCompatibility.cpp, but addNewVersion runs on one release thread while
+many request threads call isCompatible at the same time.
+
+Design:
+- Group IDs are stored per version, as in VersionManagementPrefixSum, but in chunks of
+  65536 ints. The chunk directory is allocated once and chunks are never moved, so a
+  reader can hold a pointer into the array while the writer appends.
+- publishedVersions is the only synchronization point:
+    writer: write groupID slot -> publishedVersions.store(n, release)
+    reader: published = publishedVersions.load(acquire) -> read slots <= published
+  Everything the writer stored before the release is visible after the acquire, so a
+  reader never sees a slot that is half written or belongs to a future version.
+- Readers never write shared memory, so they do not bounce cache lines between each
+  other. The shared_mutex baseline makes every reader write the lock word, and its
+  readers stall whenever the writer holds the lock for a push_back.
+*/
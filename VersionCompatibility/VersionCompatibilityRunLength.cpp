@@ -0,0 +1,311 @@
+#include<bits/stdc++.h>
+using namespace std;
+
+/**
+ * Run-length encoded Version Management
+ *
+ * Same problem as VersionCompatibility.cpp, for release histories with ~100M versions.
+ * VersionManagementPrefixSum keeps one int group ID per version (400MB at 100M versions),
+ * so every query is a cache miss. Compatibility groups are runs of consecutive versions,
+ * so it is enough to store where each run starts.
+ */
+
+/**
+ * PrefixSum-based Version Management, same as VersionCompatibility.cpp
+ * Kept here as the benchmark baseline.
+ */
+class VersionManagementPrefixSum {
+private:
+    vector<int> groupID; // groupID[i] = compatibility group of version i+1
+    int currentVersion = 0;
+    int currentGroup = 1;
+
+public:
+    void addNewVersion([[maybe_unused]] int ver, bool isCompatibleWithPrev) {
+        currentVersion++;
+
+        if (currentVersion == 1) {
+            groupID.push_back(1);
+        } else if (isCompatibleWithPrev) {
+            groupID.push_back(groupID.back());
+        } else {
+            currentGroup++;
+            groupID.push_back(currentGroup);
+        }
+    }
+
+    bool isCompatible(int srcVer, int targetVer) {
+        if (srcVer == targetVer) {
+            return true;
+        }
+        if (srcVer > targetVer) {
+            return false;
+        }
+        if (srcVer < 1 || targetVer > currentVersion) {
+            return false;
+        }
+        return groupID[srcVer - 1] == groupID[targetVer - 1];
+    }
+
+    size_t memoryBytes() const {
+        return groupID.capacity() * sizeof(int);
+    }
+};
+
+/**
+ * Run-length encoded Version Management (group boundary approach)
+ *
+ * Time Complexity:
+ * - addNewVersion(): O(1) amortized
+ * - isCompatible(): O(log g) where g is the number of compatibility groups
+ * - latestCompatible(): O(log g)
+ * - isCompatibleBatch(): O(k log g) for k pairs, searches run in lockstep
+ *
+ * Space Complexity: O(g) - one int per incompatible release, not per version
+ *
+ * Description: groupStart holds the first version of every compatibility group in
+ * ascending order (groupStart[0] = 1). srcVer can upgrade to targetVer exactly when
+ * no group starts in (srcVer, targetVer], i.e. when the group containing targetVer
+ * starts at or before srcVer.
+ */
+class VersionManagementRunLength {
+private:
+    vector<int> groupStart; // sorted first versions of each compatibility group
+    int currentVersion = 0;
+
+    /**
+     * Branchless binary search: index of the last group start <= ver
+     * The step sizes depend only on groupStart.size(), so the loop has no data
+     * dependent branches and compiles to conditional moves.
+     * @param ver: version in [1, currentVersion]
+     */
+    uint32_t groupIndexOf(int ver) const {
+        const int* base = groupStart.data();
+        uint32_t len = groupStart.size();
+        while (len > 1) {
+            uint32_t half = len / 2;
+            base = (base[half] <= ver) ? base + half : base;
+            len -= half;
+        }
+        return base - groupStart.data();
+    }
+
+public:
+    /**
+     * Adds a new version with its compatibility status
+     * @param ver: version number (should be sequential: 1, 2, 3, ...)
+     * @param isCompatibleWithPrev: whether this version is compatible with previous one
+     */
+    void addNewVersion([[maybe_unused]] int ver, bool isCompatibleWithPrev) {
+        currentVersion++;
+        if (currentVersion == 1 || !isCompatibleWithPrev) {
+            groupStart.push_back(currentVersion);
+        }
+    }
+
+    /**
+     * Checks if upgrade from srcVer to targetVer is possible
+     * @param srcVer: source version
+     * @param targetVer: target version
+     * @return: true if compatible upgrade possible, false otherwise
+     */
+    bool isCompatible(int srcVer, int targetVer) const {
+        if (srcVer == targetVer) {
+            return true;
+        }
+        if (srcVer > targetVer || srcVer < 1 || targetVer > currentVersion) {
+            return false;
+        }
+        return groupStart[groupIndexOf(targetVer)] <= srcVer;
+    }
+
+    /**
+     * Newest version srcVer can upgrade to without a migration
+     * @param srcVer: source version
+     * @return: last version of srcVer's compatibility group, -1 if srcVer is unknown
+     */
+    int latestCompatible(int srcVer) const {
+        if (srcVer < 1 || srcVer > currentVersion) {
+            return -1;
+        }
+        uint32_t next = groupIndexOf(srcVer) + 1;
+        return next < groupStart.size() ? groupStart[next] - 1 : currentVersion;
+    }
+
+    /**
+     * Bulk isCompatible over count (srcVer, targetVer) pairs
+     * Pairs are processed in blocks of Lanes. All searches in a block take the same
+     * number of halving steps, so each step is one independent load per lane: the
+     * inner loops have no branches and vectorize into gathers, and even scalar code
+     * keeps Lanes cache misses in flight instead of one.
+     * @param srcVer: source versions
+     * @param targetVer: target versions
+     * @param count: number of pairs
+     * @param result: result[i] = isCompatible(srcVer[i], targetVer[i])
+     */
+    void isCompatibleBatch(const int* srcVer, const int* targetVer, size_t count, uint8_t* result) const {
+        constexpr size_t Lanes = 16;
+        const int* starts = groupStart.data();
+        const uint32_t groups = groupStart.size();
+        const int latest = currentVersion;
+
+        size_t i = 0;
+        for (; groups > 0 && i + Lanes <= count; i += Lanes) {
+            uint32_t pos[Lanes];
+            int target[Lanes];
+            for (size_t lane = 0; lane < Lanes; lane++) {
+                pos[lane] = 0;
+                // Out of range targets are clamped so the search stays in bounds;
+                // the range check below still rejects them
+                target[lane] = min(max(targetVer[i + lane], 1), max(latest, 1));
+            }
+            for (uint32_t len = groups; len > 1; ) {
+                uint32_t half = len / 2;
+                for (size_t lane = 0; lane < Lanes; lane++) {
+                    pos[lane] += (starts[pos[lane] + half] <= target[lane]) ? half : 0;
+                }
+                len -= half;
+            }
+            for (size_t lane = 0; lane < Lanes; lane++) {
+                int src = srcVer[i + lane], tgt = targetVer[i + lane];
+                bool inRange = (src >= 1) & (src <= tgt) & (tgt <= latest);
+                result[i + lane] = (src == tgt) | (inRange & (starts[pos[lane]] <= src));
+            }
+        }
+        for (; i < count; i++) {
+            result[i] = isCompatible(srcVer[i], targetVer[i]);
+        }
+    }
+
+    void isCompatibleBatch(const vector<pair<int, int>>& queries, vector<uint8_t>& result) const {
+        vector<int> src(queries.size()), target(queries.size());
+        for (size_t i = 0; i < queries.size(); i++) {
+            src[i] = queries[i].first;
+            target[i] = queries[i].second;
+        }
+        result.resize(queries.size());
+        isCompatibleBatch(src.data(), target.data(), queries.size(), result.data());
+    }
+
+    size_t memoryBytes() const {
+        return groupStart.capacity() * sizeof(int);
+    }
+};
+
+/**
+ * Builds `versions` versions where each one breaks compatibility with probability
+ * 1 / breakEvery, then answers `queries` random upgrade checks with the PrefixSum
+ * baseline, the scalar run-length search and the batched run-length search.
+ * Queries are generated in chunks so the benchmark itself stays small in memory.
+ */
+void benchmark(int versions, long long queries, int breakEvery) {
+    mt19937 rng(7);
+    VersionManagementPrefixSum prefixSum;
+    VersionManagementRunLength runLength;
+    for (int ver = 1; ver <= versions; ver++) {
+        bool compatible = rng() % breakEvery != 0;
+        prefixSum.addNewVersion(ver, compatible);
+        runLength.addNewVersion(ver, compatible);
+    }
+
+    const size_t chunk = 1 << 20;
+    vector<int> src(chunk), target(chunk);
+    vector<uint8_t> result(chunk);
+    double prefixMs = 0, scalarMs = 0, batchMs = 0;
+    long long prefixHits = 0, scalarHits = 0, batchHits = 0;
+    auto elapsed = [](chrono::steady_clock::time_point start) {
+        return chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+    };
+
+    for (long long done = 0; done < queries; done += chunk) {
+        size_t n = min<long long>(chunk, queries - done);
+        for (size_t i = 0; i < n; i++) {
+            src[i] = 1 + rng() % versions;
+            target[i] = src[i] + rng() % (2 * breakEvery);
+        }
+
+        auto start = chrono::steady_clock::now();
+        for (size_t i = 0; i < n; i++) prefixHits += prefixSum.isCompatible(src[i], target[i]);
+        prefixMs += elapsed(start);
+
+        start = chrono::steady_clock::now();
+        for (size_t i = 0; i < n; i++) scalarHits += runLength.isCompatible(src[i], target[i]);
+        scalarMs += elapsed(start);
+
+        start = chrono::steady_clock::now();
+        runLength.isCompatibleBatch(src.data(), target.data(), n, result.data());
+        for (size_t i = 0; i < n; i++) batchHits += result[i];
+        batchMs += elapsed(start);
+    }
+
+    cout << "Versions: " << versions << ", queries: " << queries << ", break every ~" << breakEvery << " versions\n";
+    cout << "  PrefixSum:        " << prefixMs << " ms, " << prefixSum.memoryBytes() / (1 << 20) << " MB, compatible: " << prefixHits << "\n";
+    cout << "  RunLength scalar: " << scalarMs << " ms, " << runLength.memoryBytes() / 1024 << " KB, compatible: " << scalarHits << "\n";
+    cout << "  RunLength batch:  " << batchMs << " ms, compatible: " << batchHits << "\n";
+}
+
+int main() {
+    cout << "Testing RunLength implementation (O(log g) compatibility check):\n";
+    VersionManagementRunLength runLengthVersion;
+    runLengthVersion.addNewVersion(1, false);
+    runLengthVersion.addNewVersion(2, true);
+    runLengthVersion.addNewVersion(3, true);
+    runLengthVersion.addNewVersion(4, false);
+    runLengthVersion.addNewVersion(5, true);
+    runLengthVersion.addNewVersion(6, true);
+
+    assert(runLengthVersion.isCompatible(1, 3) == true);
+    assert(runLengthVersion.isCompatible(3, 5) == false);
+    assert(runLengthVersion.isCompatible(4, 2) == false);
+    assert(runLengthVersion.isCompatible(3, 3) == true);
+    assert(runLengthVersion.isCompatible(4, 6) == true);
+    assert(runLengthVersion.isCompatible(4, 7) == false);
+
+    assert(runLengthVersion.latestCompatible(1) == 3);
+    assert(runLengthVersion.latestCompatible(3) == 3);
+    assert(runLengthVersion.latestCompatible(5) == 6);
+    assert(runLengthVersion.latestCompatible(7) == -1);
+
+    vector<pair<int, int>> queries;
+    for (int src = 0; src <= 7; src++) {
+        for (int target = 0; target <= 7; target++) queries.push_back({src, target});
+    }
+    vector<uint8_t> result;
+    runLengthVersion.isCompatibleBatch(queries, result);
+    for (size_t i = 0; i < queries.size(); i++) {
+        assert(result[i] == runLengthVersion.isCompatible(queries[i].first, queries[i].second));
+    }
+    cout << "RunLength tests passed!\n\n";
+
+    benchmark(100000000, 100000000, 1000);
+    return 0;
+}
+
+/*
+Problem Summary:
+Same as VersionCompatibility.cpp, with ~100M versions and ~100M compatibility checks,
+plus latestCompatible(src): the newest version src can upgrade to without migration.
+
+Run-length encoding:
+v1 -> v2 -> v3 -> v4 -> v5 -> v6
+      T     T     F     T     T
+
+groupStart = [1, 4]
+- Group starting at 1 covers v1..v3, group starting at 4 covers v4..v6.
+
+isCompatible(src, target), src < target:
+- Find the last group start <= target (branchless binary search).
+- Compatible iff that start <= src, i.e. no incompatible release in (src, target].
+- isCompatible(3, 5): last start <= 5 is 4 > 3 -> false
+- isCompatible(4, 6): last start <= 6 is 4 <= 4 -> true
+
+latestCompatible(src):
+- The group after src's group starts at s -> answer s - 1, else the newest version.
+
+Batch queries:
+- Every search over groupStart takes exactly the same halving steps, so a block of 16
+  queries advances together: one independent load per lane per step.
+
+With one break per ~1000 versions, 100M versions need ~100K group starts (~400KB, fits
+in L2) instead of a 400MB groupID array.
+*/